@@ -0,0 +1,123 @@
+#include "ActivityDetector.h"
+#include <math.h>
+
+void ActivityDetector::begin(float noiseSigma) {
+    setNoiseSigma(noiseSigma);
+    reset();
+    state = ACTIVITY_IDLE;
+    idleMs = 0;
+    burstMs = 0;
+    transitions = 0;
+}
+
+void ActivityDetector::setNoiseSigma(float sigma) {
+    // A perfectly quiet tare would make every LSB look like an event
+    noiseSigma = sigma > 0.5f ? sigma : 0.5f;
+}
+
+void ActivityDetector::setThresholds(float enter, float exit, unsigned long minBurst) {
+    enterThreshold = enter;
+    exitThreshold = exit;
+    minBurstMs = minBurst;
+}
+
+void ActivityDetector::reset() {
+    rawCount = 0;
+    enterCount = 0;
+    hasPrevious = false;
+    rate = 0;
+    variance = 0;
+    score = 0;
+}
+
+static float median3(float a, float b, float c) {
+    if (a > b) { float t = a; a = b; b = t; }
+    if (b > c) b = c;
+    return a > b ? a : b;
+}
+
+bool ActivityDetector::update(float value, unsigned long nowMs) {
+    unsigned long dt = 0;
+    if (lastUpdateMs != 0) {
+        dt = nowMs - lastUpdateMs;
+        if (state == ACTIVITY_BURST) burstMs += dt;
+        else idleMs += dt;
+    }
+    lastUpdateMs = nowMs;
+
+    // Median of the last three inputs drops isolated spikes
+    float input = value;
+    if (rawCount == 2) input = median3(raw[0], raw[1], value);
+    else rawCount++;
+    raw[0] = raw[1];
+    raw[1] = value;
+    value = input;
+
+    if (!hasPrevious) {
+        hasPrevious = true;
+        previous = value;
+        mean = value;
+        baseline = value;
+        return false;
+    }
+
+    // EWMA factors for the actual spacing of this sample
+    float alpha = 1.0f - expf(-(float)dt / fastTauMs);
+    // In BURST the baseline follows faster, so a load that has settled (or
+    // gone) does not keep the level feature up for minutes
+    float tau = state == ACTIVITY_BURST ? burstBaselineTauMs : baselineTauMs;
+    float baselineAlpha = 1.0f - expf(-(float)dt / tau);
+
+    float step = fabsf(value - previous);
+    previous = value;
+    rate += alpha * (step - rate);
+
+    float delta = value - mean;
+    mean += alpha * delta;
+    variance = (1 - alpha) * (variance + alpha * delta * delta);
+    baseline += baselineAlpha * (value - baseline);
+
+    float rateScore = rate / (noiseSigma * 1.41421356f);
+    float devScore = sqrtf(variance) / noiseSigma;
+    float levelScore = fabsf(mean - baseline) / noiseSigma;
+    score = rateScore;
+    if (devScore > score) score = devScore;
+    if (levelScore > score) score = levelScore;
+
+    if (score >= exitThreshold) lastActiveMs = nowMs;
+
+    enterCount = score >= enterThreshold ? enterCount + 1 : 0;
+    if (enterCount > ENTER_CONFIRM) enterCount = ENTER_CONFIRM;
+
+    ActivityState next = state;
+    if (state == ACTIVITY_IDLE && enterCount >= ENTER_CONFIRM) {
+        next = ACTIVITY_BURST;
+    } else if (state == ACTIVITY_BURST && nowMs - lastActiveMs >= minBurstMs) {
+        next = ACTIVITY_IDLE;
+    }
+
+    if (next == state) return false;
+    state = next;
+    transitions++;
+    return true;
+}
+
+ActivityState ActivityDetector::getState() const {
+    return state;
+}
+
+float ActivityDetector::getScore() const {
+    return score;
+}
+
+unsigned long ActivityDetector::getIdleMs() const {
+    return idleMs;
+}
+
+unsigned long ActivityDetector::getBurstMs() const {
+    return burstMs;
+}
+
+uint32_t ActivityDetector::getTransitions() const {
+    return transitions;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdint.h>
+#include "ActivityState.h"
+
+// Decides whether a sensor stream is quiescent or active, in units of the
+// tare noise σ. Three EWMA features, each at or below ~1 on pure noise:
+//   rate  = |x[n] - x[n-1]| / (σ·√2)
+//   dev   = sqrt(EWMA variance around the EWMA mean) / σ
+//   level = |fast mean - slow baseline| / σ   (catches slow ramps)
+// BURST is entered when any stays over enterThreshold for ENTER_CONFIRM
+// samples in a row, and left only after all stay under exitThreshold for
+// minBurstMs (hysteresis on level and time).
+// Input goes through a median of 3 first, so a single-conversion spike never
+// reaches the features; a real step passes one sample late. Smoothing uses
+// time constants, not per-sample factors, so the detector behaves the same
+// at the idle and the burst sample rate.
+// Takes the timestamp as a parameter so recorded traces can be replayed on a host.
+class ActivityDetector {
+private:
+    float noiseSigma = 1.0f;
+    float enterThreshold = 4.0f;
+    float exitThreshold = 2.0f;
+    unsigned long minBurstMs = 3000;
+    const float fastTauMs = 1000.0f;       // rate, mean, variance
+    const float baselineTauMs = 25000.0f;  // slow baseline for the level feature
+    const float burstBaselineTauMs = 2500.0f;  // in BURST: settle on the new level
+    static const uint8_t ENTER_CONFIRM = 2;
+    
+    // Median-of-3 prefilter
+    float raw[2] = { 0, 0 };
+    uint8_t rawCount = 0;
+    uint8_t enterCount = 0;
+    
+    bool hasPrevious = false;
+    float previous = 0;
+    float mean = 0;
+    float variance = 0;
+    float baseline = 0;
+    float rate = 0;
+    float score = 0;
+    
+    ActivityState state = ACTIVITY_IDLE;
+    unsigned long lastActiveMs = 0;
+    
+    // Accounting for duty-cycle reports
+    unsigned long lastUpdateMs = 0;
+    unsigned long idleMs = 0;
+    unsigned long burstMs = 0;
+    uint32_t transitions = 0;
+    
+public:
+    void begin(float noiseSigma);
+    void setNoiseSigma(float sigma);
+    void setThresholds(float enter, float exit, unsigned long minBurstMs);
+    // Restart feature tracking (e.g. after tare or a mode change); keeps accounting
+    void reset();
+    
+    // Feed one sample; returns true when the state changed
+    bool update(float value, unsigned long nowMs);
+    
+    ActivityState getState() const;
+    float getScore() const;
+    unsigned long getIdleMs() const;
+    unsigned long getBurstMs() const;
+    uint32_t getTransitions() const;
+};
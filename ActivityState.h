@@ -0,0 +1,6 @@
+#pragma once
+
+enum ActivityState {
+    ACTIVITY_IDLE,
+    ACTIVITY_BURST
+};
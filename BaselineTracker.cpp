@@ -0,0 +1,55 @@
+#include "BaselineTracker.h"
+
+void BaselineTracker::begin(float quietBand, float maxSlewPerS) {
+    this->quietBand = quietBand;
+    this->maxSlewPerS = maxSlewPerS;
+    maxDrift = DRIFT_CAP_BANDS * quietBand;
+    hasLast = false;
+    quietMs = 0;
+    drift = 0;
+    retareNeeded = false;
+}
+
+float BaselineTracker::update(float residual, unsigned long nowMs) {
+    unsigned long dt = nowMs - lastMs;
+    bool gap = !hasLast || dt > MAX_GAP_MS;
+    hasLast = true;
+    lastMs = nowMs;
+
+    if (gap || residual > quietBand || residual < -quietBand) {
+        quietMs = 0;
+        return 0;
+    }
+    if (quietMs < HOLDOFF_MS) {
+        quietMs += dt;
+        return 0;
+    }
+
+    float gain = dt / TRACK_TAU_MS;
+    if (gain > 1) gain = 1;
+    float slew = maxSlewPerS * dt / 1000.0f;
+    float correction = gain * residual;
+    if (correction > slew) correction = slew;
+    if (correction < -slew) correction = -slew;
+
+    float next = drift + correction;
+    if (next > maxDrift || next < -maxDrift) {
+        next = next > 0 ? maxDrift : -maxDrift;
+        retareNeeded = true;
+    }
+    correction = next - drift;
+    drift = next;
+    return correction;
+}
+
+bool BaselineTracker::isTracking() const {
+    return quietMs >= HOLDOFF_MS;
+}
+
+bool BaselineTracker::needsRetare() const {
+    return retareNeeded;
+}
+
+float BaselineTracker::getDrift() const {
+    return drift;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+
+// Background zero tracking. While the signal sits inside the tare noise
+// band for HOLDOFF_MS, nudges the zero toward it with a time constant of
+// TRACK_TAU_MS, clamped to maxSlewPerS so a slowly applied real load can
+// never be absorbed faster than that. Total correction is capped at
+// DRIFT_CAP_BANDS × quietBand; reaching the cap means the offset has moved
+// further than drift should, and needsRetare() stays set until begin().
+// A handful of float ops per sample and no blocking, unlike tare().
+class BaselineTracker {
+private:
+    float quietBand = 0;        // |residual| below this counts as quiescent
+    float maxSlewPerS = 0;      // Max zero correction per second
+    float maxDrift = 0;
+    const float TRACK_TAU_MS = 10000.0f;
+    const float DRIFT_CAP_BANDS = 3.0f;
+    const unsigned long HOLDOFF_MS = 5000;
+    const unsigned long MAX_GAP_MS = 2000;  // Longer gaps (other mode active) restart the holdoff
+    
+    bool hasLast = false;
+    unsigned long lastMs = 0;
+    unsigned long quietMs = 0;  // How long the signal has been quiescent
+    float drift = 0;            // Total correction since begin()
+    bool retareNeeded = false;
+    
+public:
+    void begin(float quietBand, float maxSlewPerS);
+    
+    // residual = reading - current zero; returns the correction to add
+    // to the zero (0 while the signal is active or still settling)
+    float update(float residual, unsigned long nowMs);
+    
+    bool isTracking() const;
+    bool needsRetare() const;
+    float getDrift() const;
+};
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Little-endian field packing shared by the binary telemetry formats, so
+// node and host agree regardless of compiler struct layout.
+
+inline void putU16(uint8_t* p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+inline void putU32(uint8_t* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (v >> (8 * i)) & 0xFF;
+}
+
+inline void putFloat(uint8_t* p, float f) {
+    uint32_t v;
+    memcpy(&v, &f, sizeof(v));
+    putU32(p, v);
+}
+
+inline uint16_t getU16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+inline uint32_t getU32(const uint8_t* p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) v |= (uint32_t)p[i] << (8 * i);
+    return v;
+}
+
+inline float getFloat(const uint8_t* p) {
+    uint32_t v = getU32(p);
+    float f;
+    memcpy(&f, &v, sizeof(f));
+    return f;
+}
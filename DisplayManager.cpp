@@ -71,8 +71,10 @@ void DisplayManager::showLoadCell(float weight, bool holdMode) {
     setCursor(0, 1);
     print("Berat:");
     
+    char line[21];
+    snprintf(line, sizeof(line), "%.2f g       ", weight);
     setCursor(0, 2);
-    print(String(weight, 2) + " g       ");
+    print(line);
 
     setCursor(0, 3);
     print("                ");
@@ -88,8 +90,10 @@ void DisplayManager::showStrainGauge(float loadPercent, SystemStatus status, flo
     snprintf(modeText, sizeof(modeText), "%s", holdMode ? "STRAIN HOLD" : "STRAIN LIVE");
     printCentered(0, modeText);
 
+    char line[21];
+    snprintf(line, sizeof(line), "LOAD   : %.1f %%   ", loadPercent);
     setCursor(0, 1);
-    print("LOAD   : " + String(loadPercent, 1) + " %   ");
+    print(line);
 
     const char* statusText;
     switch (status) {
@@ -100,11 +104,13 @@ void DisplayManager::showStrainGauge(float loadPercent, SystemStatus status, flo
         default:             statusText = "UNKNOWN"; break;
     }
 
+    snprintf(line, sizeof(line), "STATUS : %s   ", statusText);
     setCursor(0, 2);
-    print("STATUS : " + String(statusText) + "   ");
+    print(line);
 
+    snprintf(line, sizeof(line), "STRAIN : %.6f   ", strain);
     setCursor(0, 3);
-    print("STRAIN : " + String(strain, 6) + "   ");
+    print(line);
 }
 
 void DisplayManager::showModeChange(SensorMode mode) {
@@ -1,4 +1,5 @@
 #include <Arduino.h>
+#include <sys/time.h>
 #include "FirebaseManager.h"
 
 void FirebaseManager::begin() {
@@ -24,36 +25,69 @@ bool FirebaseManager::isReady() const {
     return initialized && Firebase.ready();
 }
 
-void FirebaseManager::sendLoadCellData(float load) {
-    if (!isReady()) return;
+// Key = epoch in milliseconds. Windows are also flushed early (mode change,
+// tare), so two uploads can land in the same second; a seconds key would
+// let the short flush overwrite the full window before it.
+const char* FirebaseManager::makePath(const char* node) {
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    snprintf(pathBuffer, sizeof(pathBuffer), "/%s/%ld%03ld", node, (long)now.tv_sec, (long)(now.tv_usec / 1000));
+    return pathBuffer;
+}
+
+void FirebaseManager::sendPayload(const char* label) {
+    if (!writer.ok()) {
+        Serial.printf("Firebase payload truncated - %s\n", label);
+        return;
+    }
 
-    time_t ts = time(nullptr);
-    String path = "/loadCells/" + String(ts) + "/load";
+    sendProbe.start();
+    json.setJsonData(writer.c_str());
+    bool ok = Firebase.RTDB.setJSON(&fbdo, pathBuffer, &json);
+    sendProbe.stop();
 
-    if (Firebase.RTDB.setFloat(&fbdo, path.c_str(), load)) {
-        Serial.println("Firebase OK - Load Cell");
+    if (ok) {
+        countSent(writer.size());
+        Serial.printf("Firebase OK - %s (heap %+ld B)\n", label, (long)sendProbe.getLastFreeDrop());
     } else {
         Serial.printf("Firebase error: %s\n", fbdo.errorReason().c_str());
     }
 }
 
-void FirebaseManager::sendStrainGaugeData(float avgVoltage, float deltaL, float load, 
-                                         float strain, float stress, float vr) {
+void FirebaseManager::sendLoadCellStats(const RunningStats& load) {
     if (!isReady()) return;
+    if (load.getCount() == 0) return;
 
-    time_t ts = time(nullptr);
-    String path = "/strainGauges/" + String(ts);
+    makePath("loadCells");
+    writeLoadCellJson(writer, load);
 
-    FirebaseJson json;
-    json.set("avgVoltage", avgVoltage);
-    json.set("deltaL", deltaL);
-    json.set("load", load);
-    json.set("strain", strain);
-    json.set("stress", stress);
-    json.set("vr", vr);
+    sendPayload("Load Cell");
+}
 
-    if (Firebase.RTDB.setJSON(&fbdo, path.c_str(), &json)) {
-        Serial.println("Firebase OK - Strain Gauge");
+void FirebaseManager::sendStrainGaugeStats(const RunningStats& avgVoltage, const RunningStats& deltaL,
+                                           const RunningStats& load, const RunningStats& strain,
+                                           const RunningStats& stress, const RunningStats& vr) {
+    if (!isReady()) return;
+    if (load.getCount() == 0) return;
+
+    makePath("strainGauges");
+    writeStrainGaugeJson(writer, avgVoltage, deltaL, load, strain, stress, vr);
+
+    sendPayload("Strain Gauge");
+}
+
+void FirebaseManager::sendStrainSeries(const uint8_t* data, size_t size) {
+    if (!isReady()) return;
+
+    makePath("strainSeries");
+
+    sendProbe.start();
+    bool ok = Firebase.RTDB.setBlob(&fbdo, pathBuffer, const_cast<uint8_t*>(data), size);
+    sendProbe.stop();
+
+    if (ok) {
+        countSent(size);
+        Serial.printf("Firebase OK - Strain Series (%u B)\n", (unsigned)size);
     } else {
         Serial.printf("Firebase error: %s\n", fbdo.errorReason().c_str());
     }
@@ -62,16 +96,37 @@ void FirebaseManager::sendStrainGaugeData(float avgVoltage, float deltaL, float
 void FirebaseManager::sendAlert(const char* message, const char* type) {
     if (!isReady()) return;
 
-    time_t ts = time(nullptr);
-    String path = "/alerts/" + String(ts);
+    makePath("alerts");
 
-    FirebaseJson json;
-    json.set("message", message);
-    json.set("type", type);
+    writer.reset();
+    writer.beginObject();
+    writer.add("message", message);
+    writer.add("type", type);
+    writer.endObject();
 
-    if (Firebase.RTDB.setJSON(&fbdo, path.c_str(), &json)) {
-        Serial.println("Firebase OK - Alert");
-    } else {
-        Serial.printf("Firebase error: %s\n", fbdo.errorReason().c_str());
-    }
+    sendPayload("Alert");
+}
+
+void FirebaseManager::sendHeapStats(const HeapMonitor& heap, float strainDriftAdc, float loadCellDriftG) {
+    if (!isReady()) return;
+
+    makePath("health");
+
+    writer.reset();
+    writer.beginObject();
+    writer.add("freeHeap", (long)heap.getFreeHeap());
+    writer.add("minFreeHeap", (long)heap.getMinFreeHeap());
+    writer.add("largestBlock", (long)heap.getLargestFreeBlock());
+    writer.add("minLargestBlock", (long)heap.getMinLargestFreeBlock());
+    writer.add("fragmentation", heap.getFragmentation());
+    writer.add("maxFragmentation", heap.getMaxFragmentation());
+    writer.add("sendHeapDrop", (long)sendProbe.getLastFreeDrop());
+    writer.add("sendBlockDrop", (long)sendProbe.getLastBlockDrop());
+    writer.add("maxSendHeapDrop", (long)sendProbe.getWorstFreeDrop());
+    writer.add("maxSendBlockDrop", (long)sendProbe.getWorstBlockDrop());
+    writer.add("strainZeroDrift", strainDriftAdc);
+    writer.add("loadCellZeroDrift", loadCellDriftG);
+    writer.endObject();
+
+    sendPayload("Health");
 }
\ No newline at end of file
@@ -3,8 +3,13 @@
 #include <Firebase_ESP_Client.h>
 #include "config.h"
 #include "time.h"
+#include "HeapMonitor.h"
+#include "JsonWriter.h"
+#include "RunningStats.h"
+#include "TelemetryJson.h"
+#include "TelemetrySink.h"
 
-class FirebaseManager {
+class FirebaseManager : public TelemetrySink {
 private:
     // Firebase configuration
     const char* firebaseHost = FIREBASE_HOST;
@@ -18,12 +23,32 @@ private:
     
     bool initialized = false;
     
+    // Preallocated encode buffers, reused every send (no per-sample heap use)
+    static const size_t PATH_SIZE = 48;
+    static const size_t PAYLOAD_SIZE = 1024;
+    char pathBuffer[PATH_SIZE];
+    char payloadBuffer[PAYLOAD_SIZE];
+    JsonWriter writer = JsonWriter(payloadBuffer, PAYLOAD_SIZE);
+    // FirebaseJson copies and re-parses the text on every send, and the
+    // HTTPS client allocates too; sendProbe measures what that leaves behind
+    FirebaseJson json;
+    HeapProbe sendProbe;
+    
+    // "/<node>/<epoch ms>"
+    const char* makePath(const char* node);
+    void sendPayload(const char* label);
+    
 public:
-    void begin();
-    bool isReady() const;
+    void begin() override;
+    bool isReady() const override;
     
-    void sendLoadCellData(float load);
-    void sendStrainGaugeData(float avgVoltage, float deltaL, float load, 
-                            float strain, float stress, float vr);
-    void sendAlert(const char* message, const char* type);
-};
\ No newline at end of file
+    // Upload one aggregated window per call (min/max/mean/rms/std/p2p/n)
+    void sendLoadCellStats(const RunningStats& load) override;
+    void sendStrainGaugeStats(const RunningStats& avgVoltage, const RunningStats& deltaL,
+                              const RunningStats& load, const RunningStats& strain,
+                              const RunningStats& stress, const RunningStats& vr) override;
+    // Binary strain series (see StrainCodec.h), stored as a blob
+    void sendStrainSeries(const uint8_t* data, size_t size) override;
+    void sendAlert(const char* message, const char* type) override;
+    void sendHeapStats(const HeapMonitor& heap, float strainDriftAdc, float loadCellDriftG) override;
+};
@@ -0,0 +1,79 @@
+#include "HeapMonitor.h"
+#include <esp_heap_caps.h>
+
+void HeapMonitor::sample() {
+    freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    minFreeHeap = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    largestFreeBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    
+    fragmentation = 0;
+    if (freeHeap > 0) {
+        fragmentation = 100.0f * (1.0f - (float)largestFreeBlock / freeHeap);
+    }
+    
+    if (minLargestFreeBlock == 0 || largestFreeBlock < minLargestFreeBlock) {
+        minLargestFreeBlock = largestFreeBlock;
+    }
+    if (fragmentation > maxFragmentation) {
+        maxFragmentation = fragmentation;
+    }
+}
+
+uint32_t HeapMonitor::getFreeHeap() const {
+    return freeHeap;
+}
+
+uint32_t HeapMonitor::getMinFreeHeap() const {
+    return minFreeHeap;
+}
+
+uint32_t HeapMonitor::getLargestFreeBlock() const {
+    return largestFreeBlock;
+}
+
+uint32_t HeapMonitor::getMinLargestFreeBlock() const {
+    return minLargestFreeBlock;
+}
+
+float HeapMonitor::getFragmentation() const {
+    return fragmentation;
+}
+
+float HeapMonitor::getMaxFragmentation() const {
+    return maxFragmentation;
+}
+
+void HeapProbe::start() {
+    freeBefore = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    blockBefore = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+}
+
+void HeapProbe::stop() {
+    lastFreeDrop = (int32_t)freeBefore - (int32_t)heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    lastBlockDrop = (int32_t)blockBefore - (int32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    if (lastFreeDrop > worstFreeDrop) worstFreeDrop = lastFreeDrop;
+    if (lastBlockDrop > worstBlockDrop) worstBlockDrop = lastBlockDrop;
+}
+
+int32_t HeapProbe::getLastFreeDrop() const {
+    return lastFreeDrop;
+}
+
+int32_t HeapProbe::getLastBlockDrop() const {
+    return lastBlockDrop;
+}
+
+int32_t HeapProbe::getWorstFreeDrop() const {
+    return worstFreeDrop;
+}
+
+int32_t HeapProbe::getWorstBlockDrop() const {
+    return worstBlockDrop;
+}
+
+void HeapMonitor::printSerialOutput() const {
+    Serial.printf("Heap free %lu B (min %lu), largest block %lu B (min %lu), frag %.1f%% (max %.1f%%)\n",
+                  (unsigned long)freeHeap, (unsigned long)minFreeHeap,
+                  (unsigned long)largestFreeBlock, (unsigned long)minLargestFreeBlock,
+                  fragmentation, maxFragmentation);
+}
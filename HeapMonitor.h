@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Heap health for long-run soak checks. Fragmentation is the share of free
+// heap that is NOT available as one contiguous block.
+class HeapMonitor {
+private:
+    uint32_t freeHeap = 0;
+    uint32_t minFreeHeap = 0;
+    uint32_t largestFreeBlock = 0;
+    float fragmentation = 0;
+    
+    // Worst values seen since boot
+    uint32_t minLargestFreeBlock = 0;
+    float maxFragmentation = 0;
+    
+public:
+    void sample();
+    
+    uint32_t getFreeHeap() const;
+    uint32_t getMinFreeHeap() const;
+    uint32_t getLargestFreeBlock() const;
+    uint32_t getMinLargestFreeBlock() const;
+    float getFragmentation() const;
+    float getMaxFragmentation() const;
+    
+    void printSerialOutput() const;
+};
+
+// Heap cost of one operation (e.g. an HTTPS send): bytes of free heap and of
+// the largest free block lost between start() and stop(). Positive = the
+// operation left memory allocated or the heap more fragmented. Transient
+// allocations freed before stop() are not visible here.
+class HeapProbe {
+private:
+    uint32_t freeBefore = 0;
+    uint32_t blockBefore = 0;
+    
+    int32_t lastFreeDrop = 0;
+    int32_t lastBlockDrop = 0;
+    int32_t worstFreeDrop = 0;
+    int32_t worstBlockDrop = 0;
+    
+public:
+    void start();
+    void stop();
+    
+    int32_t getLastFreeDrop() const;
+    int32_t getLastBlockDrop() const;
+    int32_t getWorstFreeDrop() const;
+    int32_t getWorstBlockDrop() const;
+};
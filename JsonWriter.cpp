@@ -0,0 +1,100 @@
+#include "JsonWriter.h"
+#include <math.h>
+#include <stdio.h>
+
+JsonWriter::JsonWriter(char* buffer, size_t capacity)
+    : buffer(buffer), capacity(capacity) {
+    reset();
+}
+
+void JsonWriter::reset() {
+    length = 0;
+    overflow = false;
+    needComma = false;
+    if (capacity > 0) buffer[0] = '\0';
+}
+
+void JsonWriter::appendChar(char c) {
+    // Keep one byte for the terminator
+    if (length + 1 >= capacity) {
+        overflow = true;
+        return;
+    }
+    buffer[length++] = c;
+    buffer[length] = '\0';
+}
+
+void JsonWriter::append(const char* text) {
+    while (*text) appendChar(*text++);
+}
+
+void JsonWriter::appendEscaped(const char* text) {
+    appendChar('"');
+    for (; *text; text++) {
+        char c = *text;
+        if (c == '"' || c == '\\') {
+            appendChar('\\');
+            appendChar(c);
+        } else if ((unsigned char)c >= 0x20) {
+            appendChar(c);
+        }
+    }
+    appendChar('"');
+}
+
+void JsonWriter::appendKey(const char* key) {
+    if (needComma) appendChar(',');
+    if (key) {
+        appendEscaped(key);
+        appendChar(':');
+    }
+}
+
+void JsonWriter::beginObject(const char* key) {
+    appendKey(key);
+    appendChar('{');
+    needComma = false;
+}
+
+void JsonWriter::endObject() {
+    appendChar('}');
+    needComma = true;
+}
+
+void JsonWriter::add(const char* key, float value) {
+    appendKey(key);
+    if (isnan(value) || isinf(value)) {
+        append("null");
+    } else {
+        char num[20];
+        snprintf(num, sizeof(num), "%.7g", value);
+        append(num);
+    }
+    needComma = true;
+}
+
+void JsonWriter::add(const char* key, long value) {
+    appendKey(key);
+    char num[16];
+    snprintf(num, sizeof(num), "%ld", value);
+    append(num);
+    needComma = true;
+}
+
+void JsonWriter::add(const char* key, const char* value) {
+    appendKey(key);
+    appendEscaped(value);
+    needComma = true;
+}
+
+const char* JsonWriter::c_str() const {
+    return buffer;
+}
+
+size_t JsonWriter::size() const {
+    return length;
+}
+
+bool JsonWriter::ok() const {
+    return !overflow;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stddef.h>
+
+// Minimal JSON writer over a caller-owned fixed buffer. Never allocates;
+// if the buffer runs out the output is truncated and ok() returns false.
+class JsonWriter {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length = 0;
+    bool overflow = false;
+    bool needComma = false;
+    
+    void append(const char* text);
+    void appendChar(char c);
+    void appendKey(const char* key);
+    void appendEscaped(const char* text);
+    
+public:
+    JsonWriter(char* buffer, size_t capacity);
+    
+    void reset();
+    void beginObject(const char* key = nullptr);
+    void endObject();
+    
+    void add(const char* key, float value);
+    void add(const char* key, long value);
+    void add(const char* key, const char* value);
+    
+    const char* c_str() const;
+    size_t size() const;
+    bool ok() const;
+};
@@ -8,7 +8,18 @@ void LoadCellSensor::begin() {
 
 void LoadCellSensor::update() {
     if (!holdMode) {
-        currentWeight = scale.get_units(40);
+        int n = 0;
+        do {
+            estimator.add(scale.get_units(1));
+            n++;
+        } while (n < MIN_CONVERSIONS || (!estimator.isConfident() && n < MAX_CONVERSIONS));
+        lastConversions = n;
+        currentWeight = estimator.getEstimate();
+
+        // Auto-zero: follow drift while unloaded, before the dead zone
+        zeroOffset += baseline.update(currentWeight - zeroOffset, millis());
+        currentWeight -= zeroOffset;
+
         // dead zone biar nol bersih
         if (abs(currentWeight) < 5) currentWeight = 0;
     }
@@ -18,6 +29,23 @@ void LoadCellSensor::tare() {
     scale.tare();
     currentWeight = 0;
     holdWeight = 0;
+    zeroOffset = 0;
+
+    // Fill the estimator with unloaded conversions; its robust σ of single
+    // conversions, scaled to a full window, is the noise of one reading
+    estimator.begin(LOADCELL_TARGET_SE_G, 0.1f);
+    for (int i = 0; i < RobustEstimator::WINDOW; i++) {
+        estimator.add(scale.get_units(1));
+    }
+    noiseSigma = estimator.getSigma() / sqrt((float)RobustEstimator::WINDOW);
+    if (LOADCELL_TARGET_SE_G < estimator.getStdErrorFloor()) {
+        Serial.printf("LOADCELL_TARGET_SE_G %.2f g di bawah batas %.2f g (sigma/sqrt(12)), dipakai batasnya\n",
+                      (float)LOADCELL_TARGET_SE_G, estimator.getStdErrorFloor());
+    }
+    // Same band the dead zone treats as zero, or 3σ if the cell is noisier
+    float quietBand = 3 * noiseSigma;
+    if (quietBand < 5) quietBand = 5;
+    baseline.begin(quietBand, ZERO_SLEW_G_PER_S);
 }
 
 void LoadCellSensor::toggleHold() {
@@ -33,4 +61,32 @@ float LoadCellSensor::getWeight() const {
 
 bool LoadCellSensor::isHold() const {
     return holdMode;
+}
+
+float LoadCellSensor::getNoiseSigma() const {
+    return noiseSigma;
+}
+
+float LoadCellSensor::getStdError() const {
+    return estimator.getStdError();
+}
+
+int LoadCellSensor::getLastConversions() const {
+    return lastConversions;
+}
+
+uint32_t LoadCellSensor::getRejectedConversions() const {
+    return estimator.getRejected();
+}
+
+float LoadCellSensor::getZeroDrift() const {
+    return baseline.getDrift();
+}
+
+bool LoadCellSensor::needsRetare() const {
+    return baseline.needsRetare();
+}
+
+bool LoadCellSensor::isZeroTracking() const {
+    return baseline.isTracking();
 }
\ No newline at end of file
@@ -1,12 +1,22 @@
 #pragma once
 
 #include <HX711.h>
+#include "BaselineTracker.h"
+#include "RobustEstimator.h"
+#include "config.h"
+
+#ifndef LOADCELL_TARGET_SE_G
+#define LOADCELL_TARGET_SE_G 1.0
+#endif
 
 class LoadCellSensor {
 private:
     HX711 scale;
     float calibration_factor = -430.0;
     float currentWeight = 0;
+    float noiseSigma = 0;
+    float zeroOffset = 0;       // Software zero on top of the HX711 tare (g)
+    int lastConversions = 0;
     float holdWeight = 0;
     bool holdMode = false;
     
@@ -14,6 +24,17 @@ private:
     static const int DOUT_PIN = 34;
     static const int CLK_PIN = 32;
     
+    // Robust estimate over a sliding window of single conversions; each
+    // update reads MIN_CONVERSIONS, then more (up to MAX) until the
+    // standard error meets LOADCELL_TARGET_SE_G
+    RobustEstimator estimator;
+    static const int MIN_CONVERSIONS = 2;
+    static const int MAX_CONVERSIONS = 8;
+    
+    // Background auto-zero (max zero slew, g per second: 1.8 g/h)
+    BaselineTracker baseline;
+    const float ZERO_SLEW_G_PER_S = 0.0005f;
+    
 public:
     void begin();
     void update();
@@ -21,4 +42,17 @@ public:
     void toggleHold();
     float getWeight() const;
     bool isHold() const;
+    // Noise σ of one reading (g), estimated at tare
+    float getNoiseSigma() const;
+    // Standard error of the current reading (g) and HX711 conversions it took
+    float getStdError() const;
+    int getLastConversions() const;
+    // Conversions dropped as outliers since tare
+    uint32_t getRejectedConversions() const;
+    // Zero correction applied by auto-zero since the last tare (g), and
+    // whether it has hit its cap so a manual tare is needed
+    float getZeroDrift() const;
+    bool needsRetare() const;
+    // Auto-zero currently following the zero (unloaded long enough)
+    bool isZeroTracking() const;
 };
\ No newline at end of file
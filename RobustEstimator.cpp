@@ -0,0 +1,148 @@
+#include "RobustEstimator.h"
+#include <math.h>
+
+static void insertionSort(float* values, int n) {
+    for (int i = 1; i < n; i++) {
+        float v = values[i];
+        int j = i - 1;
+        while (j >= 0 && values[j] > v) {
+            values[j + 1] = values[j];
+            j--;
+        }
+        values[j + 1] = v;
+    }
+}
+
+static float sortedMedian(const float* values, int n) {
+    if (n % 2) return values[n / 2];
+    return 0.5f * (values[n / 2 - 1] + values[n / 2]);
+}
+
+void RobustEstimator::begin(float targetStdError, float minSigma) {
+    this->targetStdError = targetStdError;
+    this->minSigma = minSigma;
+    rejected = 0;
+    reset();
+}
+
+void RobustEstimator::reset() {
+    head = 0;
+    count = 0;
+    estimate = 0;
+    median = 0;
+    sigma = 0;
+    stdError = 0;
+    stdErrorFloor = 0;
+    used = 0;
+    outlierRun = 0;
+    outlierSign = 0;
+}
+
+void RobustEstimator::push(float value) {
+    samples[head] = value;
+    head = (head + 1) % WINDOW;
+    if (count < WINDOW) count++;
+}
+
+void RobustEstimator::add(float value) {
+    if (count >= MIN_SAMPLES) {
+        float deviation = value - median;
+        if (fabsf(deviation) > HAMPEL_K * sigma) {
+            int sign = deviation > 0 ? 1 : -1;
+            outlierRun = (sign == outlierSign) ? outlierRun + 1 : 1;
+            outlierSign = sign;
+            rejected++;
+        } else {
+            outlierRun = 0;
+            outlierSign = 0;
+        }
+
+        // Same-side outliers in a row that also agree with each other: the
+        // load changed, restart from them. Scattered spikes never agree.
+        if (outlierRun >= STEP_CONFIRM) {
+            float recent[STEP_CONFIRM];
+            for (int i = 0; i < STEP_CONFIRM - 1; i++) {
+                recent[i] = samples[(head + WINDOW - (STEP_CONFIRM - 1) + i) % WINDOW];
+            }
+            recent[STEP_CONFIRM - 1] = value;
+
+            float lo = recent[0];
+            float hi = recent[0];
+            for (int i = 1; i < STEP_CONFIRM; i++) {
+                if (recent[i] < lo) lo = recent[i];
+                if (recent[i] > hi) hi = recent[i];
+            }
+            if (hi - lo <= 2 * HAMPEL_K * sigma) {
+                reset();
+                for (int i = 0; i < STEP_CONFIRM; i++) push(recent[i]);
+                recompute();
+                return;
+            }
+        }
+    }
+
+    push(value);
+    recompute();
+}
+
+void RobustEstimator::recompute() {
+    float sorted[WINDOW];
+    float deviations[WINDOW];
+    for (int i = 0; i < count; i++) sorted[i] = samples[i];
+    insertionSort(sorted, count);
+    median = sortedMedian(sorted, count);
+
+    for (int i = 0; i < count; i++) deviations[i] = fabsf(sorted[i] - median);
+    insertionSort(deviations, count);
+    sigma = 1.4826f * sortedMedian(deviations, count);
+    if (sigma < minSigma) sigma = minSigma;
+
+    // Hampel: keep the contiguous run of sorted samples within K·σ
+    int first = 0;
+    int last = count - 1;
+    while (first < last && sorted[first] < median - HAMPEL_K * sigma) first++;
+    while (last > first && sorted[last] > median + HAMPEL_K * sigma) last--;
+
+    // Trimmed mean of the survivors
+    int kept = last - first + 1;
+    int trim = (int)(kept * TRIM_FRACTION);
+    first += trim;
+    last -= trim;
+
+    float sum = 0;
+    for (int i = first; i <= last; i++) sum += sorted[i];
+    used = last - first + 1;
+    estimate = sum / used;
+    stdError = sigma / sqrtf((float)used);
+    int maxUsed = WINDOW - 2 * (int)(WINDOW * TRIM_FRACTION);
+    stdErrorFloor = sigma / sqrtf((float)maxUsed);
+}
+
+float RobustEstimator::getEstimate() const {
+    return estimate;
+}
+
+float RobustEstimator::getSigma() const {
+    return sigma;
+}
+
+float RobustEstimator::getStdError() const {
+    return stdError;
+}
+
+float RobustEstimator::getStdErrorFloor() const {
+    return stdErrorFloor;
+}
+
+int RobustEstimator::getCount() const {
+    return count;
+}
+
+uint32_t RobustEstimator::getRejected() const {
+    return rejected;
+}
+
+bool RobustEstimator::isConfident() const {
+    float target = targetStdError > stdErrorFloor ? targetStdError : stdErrorFloor;
+    return count >= MIN_SAMPLES && stdError <= target;
+}
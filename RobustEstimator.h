@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+
+// Streaming robust location estimate over the last WINDOW samples:
+// median + MAD give a spike-proof centre and σ, a Hampel test drops samples
+// further than HAMPEL_K·σ from the median, and the survivors are averaged
+// after trimming the extremes. Several consecutive same-side outliers are
+// treated as a real step: the window restarts from them instead of waiting
+// for the median to move. O(WINDOW²) per sample with WINDOW = 16.
+// At most WINDOW minus the trimmed tails (12 of 16) samples are averaged,
+// so the standard error cannot go below σ/√12; a target under that floor
+// is treated as the floor (a full, spike-free window) instead of never
+// being met.
+class RobustEstimator {
+public:
+    static const int WINDOW = 16;
+    
+private:
+    static const int MIN_SAMPLES = 4;
+    static const int STEP_CONFIRM = 3;
+    const float HAMPEL_K = 3.0f;
+    const float TRIM_FRACTION = 0.125f;
+    
+    float samples[WINDOW];
+    int head = 0;
+    int count = 0;
+    
+    float targetStdError = 0;
+    float minSigma = 0;
+    
+    float estimate = 0;
+    float median = 0;
+    float sigma = 0;
+    float stdError = 0;
+    float stdErrorFloor = 0;
+    int used = 0;
+    
+    int outlierRun = 0;
+    int outlierSign = 0;
+    uint32_t rejected = 0;
+    
+    void push(float value);
+    void recompute();
+    
+public:
+    // targetStdError: reading counts as confident once σ/√n gets this low.
+    // minSigma: floor for σ so quantised, identical samples don't reject everything.
+    void begin(float targetStdError, float minSigma);
+    void reset();
+    void add(float value);
+    
+    float getEstimate() const;
+    float getSigma() const;
+    float getStdError() const;
+    // Lowest standard error the window can reach at the current σ
+    float getStdErrorFloor() const;
+    int getCount() const;
+    uint32_t getRejected() const;
+    bool isConfident() const;
+};
@@ -0,0 +1,57 @@
+#include "RunningStats.h"
+#include <math.h>
+
+void RunningStats::reset() {
+    count = 0;
+    minValue = 0;
+    maxValue = 0;
+    mean = 0;
+    m2 = 0;
+    sumSq = 0;
+}
+
+void RunningStats::add(float value) {
+    count++;
+    if (count == 1) {
+        minValue = value;
+        maxValue = value;
+    } else {
+        if (value < minValue) minValue = value;
+        if (value > maxValue) maxValue = value;
+    }
+    
+    float delta = value - mean;
+    mean += delta / count;
+    m2 += delta * (value - mean);
+    sumSq += value * value;
+}
+
+uint32_t RunningStats::getCount() const {
+    return count;
+}
+
+float RunningStats::getMin() const {
+    return minValue;
+}
+
+float RunningStats::getMax() const {
+    return maxValue;
+}
+
+float RunningStats::getMean() const {
+    return mean;
+}
+
+float RunningStats::getRms() const {
+    if (count == 0) return 0;
+    return sqrtf(sumSq / count);
+}
+
+float RunningStats::getStdDev() const {
+    if (count == 0) return 0;
+    return sqrtf(m2 / count);
+}
+
+float RunningStats::getPeakToPeak() const {
+    return maxValue - minValue;
+}
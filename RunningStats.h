@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+
+// Streaming min/max/mean/RMS/stddev over one window, O(1) per sample.
+// Mean and variance use Welford's update so large offsets (e.g. stress in Pa)
+// don't cancel out in float.
+class RunningStats {
+private:
+    uint32_t count = 0;
+    float minValue = 0;
+    float maxValue = 0;
+    float mean = 0;
+    float m2 = 0;       // Sum of squared deviations from the mean
+    float sumSq = 0;    // Sum of squares, for RMS
+    
+public:
+    void reset();
+    void add(float value);
+    
+    uint32_t getCount() const;
+    float getMin() const;
+    float getMax() const;
+    float getMean() const;
+    float getRms() const;
+    float getStdDev() const;
+    float getPeakToPeak() const;
+};
@@ -0,0 +1,170 @@
+#include "StrainCodec.h"
+#include "ByteOrder.h"
+
+static const uint8_t MAGIC_0 = 'S';
+static const uint8_t MAGIC_1 = 'G';
+static const uint8_t FORMAT_VERSION = 1;
+static const size_t COUNT_OFFSET = 4;
+static const size_t PERIOD_OFFSET = 10;
+
+static uint32_t zigzagEncode(int32_t n) {
+    return ((uint32_t)n << 1) ^ (uint32_t)(n >> 31);
+}
+
+static int32_t zigzagDecode(uint32_t n) {
+    return (int32_t)(n >> 1) ^ -(int32_t)(n & 1);
+}
+
+StrainSeriesEncoder::StrainSeriesEncoder(uint8_t* buffer, size_t capacity)
+    : buffer(buffer), capacity(capacity) {
+}
+
+void StrainSeriesEncoder::begin(const StrainCalibration& calibration, uint32_t startTime,
+                                uint16_t samplePeriodMs) {
+    length = 0;
+    previous = 0;
+    count = 0;
+    overflow = capacity < HEADER_SIZE;
+    if (overflow) return;
+
+    uint8_t* p = buffer;
+    p[0] = MAGIC_0;
+    p[1] = MAGIC_1;
+    p[2] = FORMAT_VERSION;
+    p[3] = calibration.averageLength;
+    putU16(p + COUNT_OFFSET, 0);
+    putU32(p + 6, startTime);
+    putU16(p + PERIOD_OFFSET, samplePeriodMs);
+
+    const float fields[10] = {
+        calibration.offsetAdc, calibration.noiseThresholdAdc,
+        calibration.vref, calibration.vin, calibration.adcMax,
+        calibration.gain, calibration.gaugeFactor,
+        calibration.plateLength, calibration.modulusE, calibration.strainMax
+    };
+    for (int i = 0; i < 10; i++) {
+        putFloat(p + 12 + 4 * i, fields[i]);
+    }
+
+    length = HEADER_SIZE;
+}
+
+bool StrainSeriesEncoder::add(int32_t sample) {
+    if (overflow || count == 0xFFFF) return false;
+
+    // Encode into scratch first so a sample is never half-written
+    uint8_t scratch[5];
+    size_t n = 0;
+    uint32_t v = zigzagEncode(sample - previous);
+    do {
+        uint8_t byte = v & 0x7F;
+        v >>= 7;
+        if (v) byte |= 0x80;
+        scratch[n++] = byte;
+    } while (v);
+
+    if (length + n > capacity) {
+        overflow = true;
+        return false;
+    }
+
+    memcpy(buffer + length, scratch, n);
+    length += n;
+    previous = sample;
+    count++;
+    putU16(buffer + COUNT_OFFSET, count);
+    return true;
+}
+
+void StrainSeriesEncoder::setSamplePeriod(uint16_t samplePeriodMs) {
+    if (length < HEADER_SIZE) return;
+    putU16(buffer + PERIOD_OFFSET, samplePeriodMs);
+}
+
+const uint8_t* StrainSeriesEncoder::data() const {
+    return buffer;
+}
+
+size_t StrainSeriesEncoder::size() const {
+    return length;
+}
+
+uint16_t StrainSeriesEncoder::getCount() const {
+    return count;
+}
+
+bool StrainSeriesEncoder::ok() const {
+    return !overflow;
+}
+
+bool StrainSeriesDecoder::begin(const uint8_t* data, size_t length) {
+    this->data = data;
+    this->length = length;
+    pos = 0;
+    previous = 0;
+    decoded = 0;
+
+    if (length < StrainSeriesEncoder::HEADER_SIZE) return false;
+    if (data[0] != MAGIC_0 || data[1] != MAGIC_1 || data[2] != FORMAT_VERSION) return false;
+
+    StrainCalibration& cal = header.calibration;
+    cal.averageLength = data[3];
+    header.sampleCount = getU16(data + COUNT_OFFSET);
+    header.startTime = getU32(data + 6);
+    header.samplePeriodMs = getU16(data + PERIOD_OFFSET);
+
+    float* fields[10] = {
+        &cal.offsetAdc, &cal.noiseThresholdAdc,
+        &cal.vref, &cal.vin, &cal.adcMax,
+        &cal.gain, &cal.gaugeFactor,
+        &cal.plateLength, &cal.modulusE, &cal.strainMax
+    };
+    for (int i = 0; i < 10; i++) {
+        *fields[i] = getFloat(data + 12 + 4 * i);
+    }
+
+    pos = StrainSeriesEncoder::HEADER_SIZE;
+    return cal.averageLength > 0;
+}
+
+bool StrainSeriesDecoder::next(int32_t& sample) {
+    if (decoded >= header.sampleCount) return false;
+
+    uint32_t v = 0;
+    int shift = 0;
+    while (true) {
+        if (pos >= length || shift > 28) return false;
+        uint8_t byte = data[pos++];
+        v |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) break;
+        shift += 7;
+    }
+
+    previous += zigzagDecode(v);
+    sample = previous;
+    decoded++;
+    return true;
+}
+
+const StrainSeriesHeader& StrainSeriesDecoder::getHeader() const {
+    return header;
+}
+
+StrainReading reconstructStrain(const StrainCalibration& cal, int32_t sample) {
+    StrainReading r;
+
+    float adcAvg = sample / (float)cal.averageLength;
+    r.adcNet = cal.offsetAdc - adcAvg;  // REVERSE POLARITY
+    if (r.adcNet < cal.noiseThresholdAdc && r.adcNet > -cal.noiseThresholdAdc) r.adcNet = 0;
+
+    r.vout = r.adcNet * cal.vref / cal.adcMax;
+    r.vr = r.vout / (cal.vin * cal.gain);
+    r.strain = (4 * r.vr) / (cal.gaugeFactor * (1 + 2 * r.vr));
+    r.deltaL = r.strain * cal.plateLength;
+    r.stress = r.strain * cal.modulusE;
+
+    r.loadPercent = (r.strain / cal.strainMax) * 100.0f;
+    if (r.loadPercent < 0) r.loadPercent = 0;
+    if (r.loadPercent > 100) r.loadPercent = 100;
+    return r;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Compact strain time-series: raw quantised ADC samples (moving-average sum,
+// i.e. adcAvg * averageLength) stored as zigzag-varint deltas after a header
+// holding the calibration constants. Everything StrainGaugeSensor derives
+// (Vout, Vr, strain, deltaL, stress, load %) can be rebuilt from a sample
+// with reconstructStrain(), so only the ADC value is sent.
+//
+// Layout (little-endian):
+//   "SG" magic, version, averageLength, sampleCount (u16), startTime (u32),
+//   samplePeriodMs (u16), 10 x float calibration, then one varint per sample.
+// samplePeriodMs is the measured mean spacing of the samples, written by
+// setSamplePeriod() when the window closes; begin() only stores the nominal
+// value. Sample i was taken at about startTime + i * samplePeriodMs.
+//
+// Size: the first sample is absolute (adcSum up to N * 4095, 3 bytes);
+// after that one conversion changes per sample, so |delta| <= 4095 and a
+// delta takes 1-2 bytes (1 byte while |delta| < 64). 3 bytes only after
+// a buffer refill such as tare.
+//
+// No Arduino dependencies so the same files build on a host for decoding.
+
+struct StrainCalibration {
+    float offsetAdc;
+    float noiseThresholdAdc;
+    float vref;
+    float vin;
+    float adcMax;
+    float gain;
+    float gaugeFactor;
+    float plateLength;
+    float modulusE;
+    float strainMax;
+    uint8_t averageLength;
+};
+
+struct StrainSeriesHeader {
+    uint32_t startTime;
+    uint16_t samplePeriodMs;
+    uint16_t sampleCount;
+    StrainCalibration calibration;
+};
+
+struct StrainReading {
+    float adcNet;
+    float vout;
+    float vr;
+    float strain;
+    float deltaL;
+    float stress;
+    float loadPercent;
+};
+
+class StrainSeriesEncoder {
+private:
+    uint8_t* buffer;
+    size_t capacity;
+    size_t length = 0;
+    int32_t previous = 0;
+    uint16_t count = 0;
+    bool overflow = false;
+    
+public:
+    static const size_t HEADER_SIZE = 52;
+    
+    StrainSeriesEncoder(uint8_t* buffer, size_t capacity);
+    
+    void begin(const StrainCalibration& calibration, uint32_t startTime, uint16_t samplePeriodMs);
+    // Returns false (and drops the sample) once the buffer is full
+    bool add(int32_t sample);
+    // Overwrite the header's sample period, e.g. with the measured mean
+    void setSamplePeriod(uint16_t samplePeriodMs);
+    
+    const uint8_t* data() const;
+    size_t size() const;
+    uint16_t getCount() const;
+    bool ok() const;
+};
+
+class StrainSeriesDecoder {
+private:
+    const uint8_t* data = nullptr;
+    size_t length = 0;
+    size_t pos = 0;
+    int32_t previous = 0;
+    uint16_t decoded = 0;
+    StrainSeriesHeader header;
+    
+public:
+    // Parses the header; false if the buffer is not a valid series
+    bool begin(const uint8_t* data, size_t length);
+    // Next raw sample; false at end of series or on a truncated varint
+    bool next(int32_t& sample);
+    
+    const StrainSeriesHeader& getHeader() const;
+};
+
+// Same math as StrainGaugeSensor::update(), for the consumer side
+StrainReading reconstructStrain(const StrainCalibration& calibration, int32_t sample);
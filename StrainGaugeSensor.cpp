@@ -24,6 +24,10 @@ void StrainGaugeSensor::update() {
         idx = (idx + 1) % N;
 
         adcAvg = adcSum / (float)N;
+
+        // Auto-zero: follow thermal drift while the plate is quiescent
+        offsetAdc += baseline.update(adcAvg - offsetAdc, millis());
+
         adcNet = offsetAdc - adcAvg;  // REVERSE POLARITY
 
         // Filter noise
@@ -40,12 +44,8 @@ void StrainGaugeSensor::update() {
         updateStrainHoldValues();
     }
     
-    // Update alert tracking
-    SystemStatus currentStatus = getStatus();
-    if (currentStatus != lastAlertStatus) {
-        alertSent = false;
-        lastAlertStatus = currentStatus;
-    }
+    // Re-arm alerts once the load is clearly back to normal
+    if (getLoadPercent() < ALERT_REARM_PERCENT) alertedStatus = STATUS_NORMAL;
 }
 
 void StrainGaugeSensor::tare() {
@@ -71,6 +71,7 @@ void StrainGaugeSensor::tare() {
     float meanSq = sumSq / (float)samples;
     noiseAdc = sqrt(meanSq - offsetAdc * offsetAdc);
     noiseThresholdAdc = 3 * noiseAdc;   // 3σ
+    baseline.begin(noiseThresholdAdc, ZERO_SLEW_ADC_PER_S);
 
     // Reset moving average buffer
     adcSum = 0;
@@ -148,6 +149,44 @@ bool StrainGaugeSensor::isHold() const {
     return holdMode;
 }
 
+long StrainGaugeSensor::getAdcSum() const {
+    return adcSum;
+}
+
+int StrainGaugeSensor::getLastAdc() const {
+    return adcBuffer[(idx + N - 1) % N];
+}
+
+float StrainGaugeSensor::getNoiseAdc() const {
+    return noiseAdc;
+}
+
+float StrainGaugeSensor::getZeroDrift() const {
+    return baseline.getDrift();
+}
+
+bool StrainGaugeSensor::needsRetare() const {
+    return baseline.needsRetare();
+}
+
+bool StrainGaugeSensor::isZeroTracking() const {
+    return baseline.isTracking();
+}
+
+void StrainGaugeSensor::getCalibration(StrainCalibration& cal) const {
+    cal.offsetAdc = offsetAdc;
+    cal.noiseThresholdAdc = noiseThresholdAdc;
+    cal.vref = Vref;
+    cal.vin = Vin;
+    cal.adcMax = ADC_MAX;
+    cal.gain = gain;
+    cal.gaugeFactor = gf;
+    cal.plateLength = panjangPlat;
+    cal.modulusE = modulusE;
+    cal.strainMax = STRAIN_MAX;
+    cal.averageLength = N;
+}
+
 void StrainGaugeSensor::updateBuzzerAndLED() {
     SystemStatus status = getStatus();
     
@@ -169,8 +208,11 @@ void StrainGaugeSensor::updateBuzzerAndLED() {
 }
 
 bool StrainGaugeSensor::shouldSendAlert() const {
-    SystemStatus status = getStatus();
-    return (status != STATUS_NORMAL && !alertSent);
+    return getStatus() > alertedStatus;
+}
+
+void StrainGaugeSensor::markAlertSent() {
+    alertedStatus = getStatus();
 }
 
 const char* StrainGaugeSensor::getAlertMessage() const {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "SystemStatus.h"
+#include "StrainCodec.h"
+#include "BaselineTracker.h"
 #include <Arduino.h>
 
 class StrainGaugeSensor {
@@ -47,9 +49,15 @@ private:
     // Taring
     bool isTaring = false;
     
-    // Alert tracking
-    SystemStatus lastAlertStatus = STATUS_NORMAL;
-    bool alertSent = false;
+    // Background auto-zero (max offset slew, ADC counts per second: 18/h)
+    BaselineTracker baseline;
+    const float ZERO_SLEW_ADC_PER_S = 0.005f;
+    
+    // Alert tracking: highest status already alerted. Re-armed only once the
+    // load falls below ALERT_REARM_PERCENT, so a load hovering on a threshold
+    // (or a burst of 20 Hz samples) sends one alert per escalation.
+    SystemStatus alertedStatus = STATUS_NORMAL;
+    const float ALERT_REARM_PERCENT = 25.0f;
     
     // Helper methods
     void updateStrainHoldValues();
@@ -71,11 +79,28 @@ public:
     float getVr() const;
     bool isHold() const;
     
+    // Raw quantised sample (moving-average sum) and the constants needed
+    // to rebuild every derived value from it, for StrainSeriesEncoder
+    long getAdcSum() const;
+    void getCalibration(StrainCalibration& cal) const;
+    
+    // Latest single conversion and its tare noise σ, for ActivityDetector
+    int getLastAdc() const;
+    float getNoiseAdc() const;
+    
+    // Offset correction applied by auto-zero since the last tare (ADC
+    // counts), and whether it has hit its cap so a manual tare is needed
+    float getZeroDrift() const;
+    bool needsRetare() const;
+    // Auto-zero currently following the offset (quiescent long enough)
+    bool isZeroTracking() const;
+    
     // Buzzer and LED
     void updateBuzzerAndLED();
     
     // Alert methods
     bool shouldSendAlert() const;
+    void markAlertSent();
     const char* getAlertMessage() const;
     const char* getAlertType() const;
     
@@ -0,0 +1,36 @@
+#include "TelemetryAggregator.h"
+
+void TelemetryAggregator::begin() {
+    reset();
+}
+
+void TelemetryAggregator::add(TelemetryChannel channel, float value) {
+    channels[channel].add(value);
+}
+
+bool TelemetryAggregator::isWindowComplete() const {
+    return getElapsed() >= windowMs;
+}
+
+unsigned long TelemetryAggregator::getElapsed() const {
+    return millis() - windowStart;
+}
+
+void TelemetryAggregator::reset() {
+    for (int i = 0; i < TELEMETRY_CHANNEL_COUNT; i++) {
+        channels[i].reset();
+    }
+    windowStart = millis();
+}
+
+void TelemetryAggregator::setWindow(unsigned long ms) {
+    windowMs = ms;
+}
+
+unsigned long TelemetryAggregator::getWindow() const {
+    return windowMs;
+}
+
+const RunningStats& TelemetryAggregator::getStats(TelemetryChannel channel) const {
+    return channels[channel];
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "RunningStats.h"
+#include "TelemetryChannel.h"
+
+#ifndef TELEMETRY_WINDOW_MS
+#define TELEMETRY_WINDOW_MS 5000
+#endif
+
+// Tumbling-window aggregation: samples go in every loop, one summary per
+// channel comes out when the window closes, then the window restarts.
+class TelemetryAggregator {
+private:
+    RunningStats channels[TELEMETRY_CHANNEL_COUNT];
+    unsigned long windowMs = TELEMETRY_WINDOW_MS;
+    unsigned long windowStart = 0;
+    
+public:
+    void begin();
+    void add(TelemetryChannel channel, float value);
+    
+    // True once the current window has run its full length
+    bool isWindowComplete() const;
+    unsigned long getElapsed() const;
+    // Clears all channels and starts a new window
+    void reset();
+    
+    void setWindow(unsigned long ms);
+    unsigned long getWindow() const;
+    const RunningStats& getStats(TelemetryChannel channel) const;
+};
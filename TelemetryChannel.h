@@ -0,0 +1,13 @@
+#pragma once
+
+// Every quantity the sensors produce, one aggregation channel each
+enum TelemetryChannel {
+    CH_LOAD_WEIGHT,
+    CH_STRAIN_VOUT,
+    CH_STRAIN_DELTA_L,
+    CH_STRAIN_LOAD_PERCENT,
+    CH_STRAIN_STRAIN,
+    CH_STRAIN_STRESS,
+    CH_STRAIN_VR,
+    TELEMETRY_CHANNEL_COUNT
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stddef.h>
+#include "ByteOrder.h"
+
+// Datagram framing for the local telemetry sink. Shared with the host
+// collector (tools/telemetry_collector.cpp), so no Arduino dependencies.
+//
+// Header (16 B, little-endian):
+//   magic "SH" (u16 0x4853), version, type, nodeId (u16), seq (u32),
+//   uptimeMs (u32), payloadLength (u16)
+//
+// Payloads:
+//   LOAD_SAMPLE    f32 weight
+//   STRAIN_SAMPLE  i32 adcSum, f32 loadPercent, f32 strain, u8 status
+//   LOAD_STATS     1 x stats block
+//   STRAIN_STATS   6 x stats block (avgVoltage, deltaL, load, strain, stress, vr)
+//   STRAIN_SERIES  raw StrainCodec series
+//   ALERT          u8 len + message, u8 len + type
+//   HEALTH         u32 free, minFree, largest, minLargest, f32 frag, maxFrag,
+//                  f32 strainZeroDrift (ADC), loadCellZeroDrift (g)
+// A stats block is u32 count + f32 min, max, mean, rms, std, p2p (28 B).
+// Fields are only ever appended to a payload, so FRAME_VERSION stays 1;
+// readers parse what payloadLength covers (HEALTH from older firmware is
+// 24 B, without the drift fields).
+
+static const uint16_t FRAME_MAGIC = 0x4853;
+static const uint8_t FRAME_VERSION = 1;
+static const size_t FRAME_HEADER_SIZE = 16;
+static const size_t FRAME_STATS_SIZE = 28;
+static const size_t FRAME_HEALTH_HEAP_SIZE = 24;  // Original HEALTH payload
+static const size_t FRAME_HEALTH_SIZE = 32;
+
+enum FrameType {
+    FRAME_LOAD_SAMPLE = 1,
+    FRAME_STRAIN_SAMPLE,
+    FRAME_LOAD_STATS,
+    FRAME_STRAIN_STATS,
+    FRAME_STRAIN_SERIES,
+    FRAME_ALERT,
+    FRAME_HEALTH
+};
+
+struct FrameHeader {
+    uint8_t type;
+    uint16_t nodeId;
+    uint32_t seq;
+    uint32_t uptimeMs;
+    uint16_t payloadLength;
+};
+
+inline void writeFrameHeader(uint8_t* p, const FrameHeader& h) {
+    putU16(p, FRAME_MAGIC);
+    p[2] = FRAME_VERSION;
+    p[3] = h.type;
+    putU16(p + 4, h.nodeId);
+    putU32(p + 6, h.seq);
+    putU32(p + 10, h.uptimeMs);
+    putU16(p + 14, h.payloadLength);
+}
+
+// False if the datagram is too short, foreign, or its length disagrees
+inline bool readFrameHeader(const uint8_t* p, size_t length, FrameHeader& h) {
+    if (length < FRAME_HEADER_SIZE) return false;
+    if (getU16(p) != FRAME_MAGIC || p[2] != FRAME_VERSION) return false;
+    h.type = p[3];
+    h.nodeId = getU16(p + 4);
+    h.seq = getU32(p + 6);
+    h.uptimeMs = getU32(p + 10);
+    h.payloadLength = getU16(p + 14);
+    return FRAME_HEADER_SIZE + h.payloadLength <= length;
+}
@@ -0,0 +1,34 @@
+#include "TelemetryJson.h"
+
+void writeStatsJson(JsonWriter& writer, const char* key, const RunningStats& stats) {
+    writer.beginObject(key);
+    writer.add("min", stats.getMin());
+    writer.add("max", stats.getMax());
+    writer.add("mean", stats.getMean());
+    writer.add("rms", stats.getRms());
+    writer.add("std", stats.getStdDev());
+    writer.add("p2p", stats.getPeakToPeak());
+    writer.add("n", (long)stats.getCount());
+    writer.endObject();
+}
+
+void writeLoadCellJson(JsonWriter& writer, const RunningStats& load) {
+    writer.reset();
+    writer.beginObject();
+    writeStatsJson(writer, "load", load);
+    writer.endObject();
+}
+
+void writeStrainGaugeJson(JsonWriter& writer, const RunningStats& avgVoltage, const RunningStats& deltaL,
+                          const RunningStats& load, const RunningStats& strain,
+                          const RunningStats& stress, const RunningStats& vr) {
+    writer.reset();
+    writer.beginObject();
+    writeStatsJson(writer, "avgVoltage", avgVoltage);
+    writeStatsJson(writer, "deltaL", deltaL);
+    writeStatsJson(writer, "load", load);
+    writeStatsJson(writer, "strain", strain);
+    writeStatsJson(writer, "stress", stress);
+    writeStatsJson(writer, "vr", vr);
+    writer.endObject();
+}
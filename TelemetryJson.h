@@ -0,0 +1,15 @@
+#pragma once
+
+#include "JsonWriter.h"
+#include "RunningStats.h"
+
+// JSON bodies of the window uploads (one object per channel with
+// min/max/mean/rms/std/p2p/n). Kept apart from FirebaseManager and free of
+// Arduino dependencies so tools/activity_replay.cpp sizes uploads with the
+// same code the device runs.
+
+void writeStatsJson(JsonWriter& writer, const char* key, const RunningStats& stats);
+void writeLoadCellJson(JsonWriter& writer, const RunningStats& load);
+void writeStrainGaugeJson(JsonWriter& writer, const RunningStats& avgVoltage, const RunningStats& deltaL,
+                          const RunningStats& load, const RunningStats& strain,
+                          const RunningStats& stress, const RunningStats& vr);
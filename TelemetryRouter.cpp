@@ -0,0 +1,37 @@
+#include "TelemetryRouter.h"
+
+bool TelemetryRouter::addSink(TelemetrySink* sink) {
+    if (sinkCount >= MAX_SINKS) return false;
+    sinks[sinkCount++] = sink;
+    return true;
+}
+
+void TelemetryRouter::begin() {
+    for (int i = 0; i < sinkCount; i++) sinks[i]->begin();
+}
+
+// Ready if at least one sink can take data
+bool TelemetryRouter::isReady() const {
+    for (int i = 0; i < sinkCount; i++) {
+        if (sinks[i]->isReady()) return true;
+    }
+    return false;
+}
+
+void TelemetryRouter::sendAlert(const char* message, const char* type) {
+    for (int i = 0; i < sinkCount; i++) sinks[i]->sendAlert(message, type);
+}
+
+void TelemetryRouter::sendHeapStats(const HeapMonitor& heap, float strainDriftAdc, float loadCellDriftG) {
+    for (int i = 0; i < sinkCount; i++) sinks[i]->sendHeapStats(heap, strainDriftAdc, loadCellDriftG);
+}
+
+void TelemetryRouter::sendLoadCellSample(float weight) {
+    for (int i = 0; i < sinkCount; i++) sinks[i]->sendLoadCellSample(weight);
+}
+
+void TelemetryRouter::sendStrainSample(long adcSum, float loadPercent, float strain, SystemStatus status) {
+    for (int i = 0; i < sinkCount; i++) {
+        sinks[i]->sendStrainSample(adcSum, loadPercent, strain, status);
+    }
+}
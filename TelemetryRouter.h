@@ -0,0 +1,27 @@
+#pragma once
+
+#include "TelemetrySink.h"
+
+// Fans node-wide events (alerts, health, per-sample stream) out to all
+// registered sinks, in registration order. Window summaries are not routed:
+// each sink has its own TelemetryWindow. Sends are blocking, so register
+// low-latency sinks (UDP) before cloud sinks, or an alert waits for an
+// HTTPS round-trip before it goes local.
+class TelemetryRouter {
+private:
+    static const int MAX_SINKS = 4;
+    TelemetrySink* sinks[MAX_SINKS];
+    int sinkCount = 0;
+    
+public:
+    bool addSink(TelemetrySink* sink);
+    
+    void begin();
+    bool isReady() const;
+    
+    void sendAlert(const char* message, const char* type);
+    void sendHeapStats(const HeapMonitor& heap, float strainDriftAdc, float loadCellDriftG);
+    
+    void sendLoadCellSample(float weight);
+    void sendStrainSample(long adcSum, float loadPercent, float strain, SystemStatus status);
+};
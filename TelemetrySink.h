@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "HeapMonitor.h"
+#include "RunningStats.h"
+#include "SystemStatus.h"
+
+// Destination for telemetry. Window-level data (stats, series, alerts,
+// health) goes to every sink; per-sample streaming is optional and
+// ignored by sinks where it would be too expensive (e.g. the cloud).
+class TelemetrySink {
+protected:
+    // What the sink actually handed to the network, for the data-volume
+    // report (payload bytes; HTTP/TLS or UDP/IP overhead not included)
+    uint32_t bytesSent = 0;
+    uint32_t messagesSent = 0;
+    
+    void countSent(size_t bytes) {
+        bytesSent += bytes;
+        messagesSent++;
+    }
+    
+public:
+    virtual ~TelemetrySink() {}
+    
+    virtual void begin() = 0;
+    virtual bool isReady() const = 0;
+    
+    virtual void sendLoadCellStats(const RunningStats& load) = 0;
+    virtual void sendStrainGaugeStats(const RunningStats& avgVoltage, const RunningStats& deltaL,
+                                      const RunningStats& load, const RunningStats& strain,
+                                      const RunningStats& stress, const RunningStats& vr) = 0;
+    virtual void sendStrainSeries(const uint8_t* data, size_t size) = 0;
+    virtual void sendAlert(const char* message, const char* type) = 0;
+    // Node health: heap figures plus each sensor's auto-zero drift since tare
+    virtual void sendHeapStats(const HeapMonitor& heap, float strainDriftAdc, float loadCellDriftG) = 0;
+    
+    virtual void sendLoadCellSample(float /*weight*/) {}
+    virtual void sendStrainSample(long /*adcSum*/, float /*loadPercent*/, float /*strain*/,
+                                  SystemStatus /*status*/) {}
+    
+    uint32_t getBytesSent() const { return bytesSent; }
+    uint32_t getMessagesSent() const { return messagesSent; }
+};
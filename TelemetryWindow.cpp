@@ -0,0 +1,79 @@
+#include "TelemetryWindow.h"
+
+TelemetryWindow::TelemetryWindow(TelemetrySink& sink) : sink(sink) {
+}
+
+void TelemetryWindow::setSeriesPeriod(unsigned long ms) {
+    seriesPeriodMs = ms;
+}
+
+void TelemetryWindow::start(unsigned long windowMs, unsigned long samplePeriodMs,
+                            const StrainCalibration& calibration) {
+    stats.reset();
+    stats.setWindow(windowMs);
+    
+    unsigned long nominal = seriesPeriodMs > samplePeriodMs ? seriesPeriodMs : samplePeriodMs;
+    series.begin(calibration, (uint32_t)time(nullptr), nominal > 0xFFFF ? 0xFFFF : nominal);
+}
+
+void TelemetryWindow::addLoadCell(float weight) {
+    stats.add(CH_LOAD_WEIGHT, weight);
+}
+
+void TelemetryWindow::addStrain(const StrainGaugeSensor& sensor) {
+    stats.add(CH_STRAIN_VOUT, sensor.getVout());
+    stats.add(CH_STRAIN_DELTA_L, sensor.getDeltaL());
+    stats.add(CH_STRAIN_LOAD_PERCENT, sensor.getLoadPercent());
+    stats.add(CH_STRAIN_STRAIN, sensor.getStrain());
+    stats.add(CH_STRAIN_STRESS, sensor.getStress());
+    stats.add(CH_STRAIN_VR, sensor.getVr());
+    
+    #if TELEMETRY_STRAIN_SERIES
+    unsigned long now = millis();
+    if (series.getCount() > 0 && now - lastSeriesMs < seriesPeriodMs) return;
+    if (series.add(sensor.getAdcSum())) {
+        if (series.getCount() == 1) firstSeriesMs = now;
+        lastSeriesMs = now;
+    }
+    #endif
+}
+
+bool TelemetryWindow::isComplete() const {
+    return stats.isWindowComplete();
+}
+
+unsigned long TelemetryWindow::getElapsed() const {
+    return stats.getElapsed();
+}
+
+void TelemetryWindow::send(SensorMode mode) {
+    TelemetryChannel first = (mode == MODE_LOAD_CELL) ? CH_LOAD_WEIGHT : CH_STRAIN_VOUT;
+    if (stats.getStats(first).getCount() == 0) return;
+    
+    if (mode == MODE_LOAD_CELL) {
+        sink.sendLoadCellStats(stats.getStats(CH_LOAD_WEIGHT));
+    } else {
+        sink.sendStrainGaugeStats(
+            stats.getStats(CH_STRAIN_VOUT),
+            stats.getStats(CH_STRAIN_DELTA_L),
+            stats.getStats(CH_STRAIN_LOAD_PERCENT),
+            stats.getStats(CH_STRAIN_STRAIN),
+            stats.getStats(CH_STRAIN_STRESS),
+            stats.getStats(CH_STRAIN_VR)
+        );
+        #if TELEMETRY_STRAIN_SERIES
+        if (!series.ok()) Serial.println("Strain series buffer full, window truncated");
+        // Measured spacing (delay + LCD + sends), not the nominal delay()
+        if (series.getCount() > 1) {
+            unsigned long period = (lastSeriesMs - firstSeriesMs) / (series.getCount() - 1);
+            series.setSamplePeriod(period > 0xFFFF ? 0xFFFF : period);
+        }
+        sink.sendStrainSeries(series.data(), series.size());
+        #endif
+    }
+    windowsSent++;
+}
+
+uint32_t TelemetryWindow::getWindowsSent() const {
+    return windowsSent;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Arduino.h>
+#include "config.h"
+#include "SensorMode.h"
+#include "StrainCodec.h"
+#include "StrainGaugeSensor.h"
+#include "TelemetryAggregator.h"
+#include "TelemetrySink.h"
+
+#ifndef TELEMETRY_STRAIN_SERIES
+#define TELEMETRY_STRAIN_SERIES 1
+#endif
+
+// One upload stream: a tumbling stats window plus the strain series of the
+// same span, delivered to a single sink. The sketch keeps one per sink so
+// the local collector can follow the sampling profile (short windows in a
+// burst) while the cloud gets long windows that never put an HTTPS write
+// inside a burst.
+class TelemetryWindow {
+private:
+    TelemetrySink& sink;
+    TelemetryAggregator stats;
+    
+    // Header 52 B + 1-3 B per sample
+    static const size_t SERIES_SIZE = 512;
+    uint8_t seriesBuffer[SERIES_SIZE];
+    StrainSeriesEncoder series = StrainSeriesEncoder(seriesBuffer, SERIES_SIZE);
+    unsigned long seriesPeriodMs = 0;
+    unsigned long firstSeriesMs = 0;
+    unsigned long lastSeriesMs = 0;
+    
+    uint32_t windowsSent = 0;
+    
+public:
+    explicit TelemetryWindow(TelemetrySink& sink);
+    
+    // Minimum spacing between series samples; 0 keeps every sample.
+    // Stats always see every sample, so window extremes are not decimated.
+    void setSeriesPeriod(unsigned long ms);
+    
+    // Starts a new window; the calibration is stored in the series header
+    void start(unsigned long windowMs, unsigned long samplePeriodMs, const StrainCalibration& calibration);
+    void addLoadCell(float weight);
+    void addStrain(const StrainGaugeSensor& sensor);
+    
+    bool isComplete() const;
+    unsigned long getElapsed() const;
+    // Sends the window so far (nothing if it is empty); call start() after
+    void send(SensorMode mode);
+    
+    uint32_t getWindowsSent() const;
+};
@@ -0,0 +1,121 @@
+#include <Arduino.h>
+#include "UdpTelemetrySink.h"
+
+UdpTelemetrySink::UdpTelemetrySink(const char* host, uint16_t port, uint16_t nodeId)
+    : collectorHost(host), collectorPort(port), nodeId(nodeId) {
+}
+
+void UdpTelemetrySink::begin() {
+    // Resolve once; per-packet host lookups would cost more than the send
+    if (collectorIp.fromString(collectorHost)) {
+        Serial.printf("UDP sink -> %s:%u (node %u)\n", collectorHost, collectorPort, nodeId);
+        initialized = true;
+    } else {
+        Serial.printf("UDP sink disabled: invalid collector address '%s'\n", collectorHost);
+        initialized = false;
+    }
+}
+
+bool UdpTelemetrySink::isReady() const {
+    return initialized && WiFi.status() == WL_CONNECTED;
+}
+
+uint8_t* UdpTelemetrySink::payload() {
+    return frameBuffer + FRAME_HEADER_SIZE;
+}
+
+void UdpTelemetrySink::writeStats(uint8_t* p, const RunningStats& stats) {
+    putU32(p, stats.getCount());
+    putFloat(p + 4, stats.getMin());
+    putFloat(p + 8, stats.getMax());
+    putFloat(p + 12, stats.getMean());
+    putFloat(p + 16, stats.getRms());
+    putFloat(p + 20, stats.getStdDev());
+    putFloat(p + 24, stats.getPeakToPeak());
+}
+
+void UdpTelemetrySink::sendFrame(FrameType type, size_t payloadLength) {
+    FrameHeader header;
+    header.type = type;
+    header.nodeId = nodeId;
+    header.seq = seq++;
+    header.uptimeMs = millis();
+    header.payloadLength = payloadLength;
+    writeFrameHeader(frameBuffer, header);
+
+    udp.beginPacket(collectorIp, collectorPort);
+    udp.write(frameBuffer, FRAME_HEADER_SIZE + payloadLength);
+    if (udp.endPacket()) countSent(FRAME_HEADER_SIZE + payloadLength);
+}
+
+void UdpTelemetrySink::sendLoadCellStats(const RunningStats& load) {
+    if (!isReady()) return;
+    writeStats(payload(), load);
+    sendFrame(FRAME_LOAD_STATS, FRAME_STATS_SIZE);
+}
+
+void UdpTelemetrySink::sendStrainGaugeStats(const RunningStats& avgVoltage, const RunningStats& deltaL,
+                                            const RunningStats& load, const RunningStats& strain,
+                                            const RunningStats& stress, const RunningStats& vr) {
+    if (!isReady()) return;
+    const RunningStats* channels[6] = { &avgVoltage, &deltaL, &load, &strain, &stress, &vr };
+    for (int i = 0; i < 6; i++) {
+        writeStats(payload() + i * FRAME_STATS_SIZE, *channels[i]);
+    }
+    sendFrame(FRAME_STRAIN_STATS, 6 * FRAME_STATS_SIZE);
+}
+
+void UdpTelemetrySink::sendStrainSeries(const uint8_t* data, size_t size) {
+    if (!isReady()) return;
+    if (FRAME_HEADER_SIZE + size > FRAME_SIZE) {
+        Serial.println("UDP sink: strain series too large for one frame");
+        return;
+    }
+    memcpy(payload(), data, size);
+    sendFrame(FRAME_STRAIN_SERIES, size);
+}
+
+void UdpTelemetrySink::sendAlert(const char* message, const char* type) {
+    if (!isReady()) return;
+    size_t messageLen = strlen(message);
+    size_t typeLen = strlen(type);
+    if (messageLen > 255) messageLen = 255;
+    if (typeLen > 255) typeLen = 255;
+
+    uint8_t* p = payload();
+    p[0] = messageLen;
+    memcpy(p + 1, message, messageLen);
+    p[1 + messageLen] = typeLen;
+    memcpy(p + 2 + messageLen, type, typeLen);
+    sendFrame(FRAME_ALERT, 2 + messageLen + typeLen);
+}
+
+void UdpTelemetrySink::sendHeapStats(const HeapMonitor& heap, float strainDriftAdc, float loadCellDriftG) {
+    if (!isReady()) return;
+    uint8_t* p = payload();
+    putU32(p, heap.getFreeHeap());
+    putU32(p + 4, heap.getMinFreeHeap());
+    putU32(p + 8, heap.getLargestFreeBlock());
+    putU32(p + 12, heap.getMinLargestFreeBlock());
+    putFloat(p + 16, heap.getFragmentation());
+    putFloat(p + 20, heap.getMaxFragmentation());
+    putFloat(p + 24, strainDriftAdc);
+    putFloat(p + 28, loadCellDriftG);
+    sendFrame(FRAME_HEALTH, FRAME_HEALTH_SIZE);
+}
+
+void UdpTelemetrySink::sendLoadCellSample(float weight) {
+    if (!isReady()) return;
+    putFloat(payload(), weight);
+    sendFrame(FRAME_LOAD_SAMPLE, 4);
+}
+
+void UdpTelemetrySink::sendStrainSample(long adcSum, float loadPercent, float strain, SystemStatus status) {
+    if (!isReady()) return;
+    uint8_t* p = payload();
+    putU32(p, (uint32_t)adcSum);
+    putFloat(p + 4, loadPercent);
+    putFloat(p + 8, strain);
+    p[12] = status;
+    sendFrame(FRAME_STRAIN_SAMPLE, 13);
+}
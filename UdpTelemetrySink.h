@@ -0,0 +1,54 @@
+#pragma once
+
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include "config.h"
+#include "TelemetryFrame.h"
+#include "TelemetrySink.h"
+
+#ifndef LOCAL_COLLECTOR_PORT
+#define LOCAL_COLLECTOR_PORT 5005
+#endif
+
+#ifndef NODE_ID
+#define NODE_ID 1
+#endif
+
+// Streams framed samples, window stats and alerts as UDP datagrams to a
+// collector on the LAN (see tools/telemetry_collector.cpp). Fire-and-forget:
+// no auth, no retries; the collector detects loss from the sequence number.
+class UdpTelemetrySink : public TelemetrySink {
+private:
+    WiFiUDP udp;
+    IPAddress collectorIp;
+    const char* collectorHost;
+    uint16_t collectorPort;
+    uint16_t nodeId;
+    uint32_t seq = 0;
+    bool initialized = false;
+    
+    // One datagram: header + largest payload (a full strain series)
+    static const size_t FRAME_SIZE = 640;
+    uint8_t frameBuffer[FRAME_SIZE];
+    
+    uint8_t* payload();
+    void writeStats(uint8_t* p, const RunningStats& stats);
+    void sendFrame(FrameType type, size_t payloadLength);
+    
+public:
+    UdpTelemetrySink(const char* host, uint16_t port = LOCAL_COLLECTOR_PORT, uint16_t nodeId = NODE_ID);
+    
+    void begin() override;
+    bool isReady() const override;
+    
+    void sendLoadCellStats(const RunningStats& load) override;
+    void sendStrainGaugeStats(const RunningStats& avgVoltage, const RunningStats& deltaL,
+                              const RunningStats& load, const RunningStats& strain,
+                              const RunningStats& stress, const RunningStats& vr) override;
+    void sendStrainSeries(const uint8_t* data, size_t size) override;
+    void sendAlert(const char* message, const char* type) override;
+    void sendHeapStats(const HeapMonitor& heap, float strainDriftAdc, float loadCellDriftG) override;
+    
+    void sendLoadCellSample(float weight) override;
+    void sendStrainSample(long adcSum, float loadPercent, float strain, SystemStatus status) override;
+};
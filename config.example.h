@@ -14,3 +14,36 @@
 
 #define DEBUG_BUTTONS 1
 
+// Telemetry aggregation window (ms); one summary uploaded per window
+#define TELEMETRY_WINDOW_MS 5000
+
+// Upload raw strain ADC series (delta/varint, see StrainCodec.h) per window
+#define TELEMETRY_STRAIN_SERIES 1
+
+// Adaptive sampling: slow idle profile, fast burst profile while the
+// signal is active (see ActivityDetector.h). 0 = fixed 10 Hz sampling.
+// Burst windows go to the local sink only; Firebase always gets
+// IDLE_WINDOW_MS windows, held back until the burst ends.
+#define ADAPTIVE_SAMPLING 1
+#define IDLE_SAMPLE_PERIOD_MS 500
+#define IDLE_WINDOW_MS 30000
+#define BURST_SAMPLE_PERIOD_MS 50
+#define BURST_WINDOW_MS 1000
+// ActivityDetector thresholds, in units of the tare noise σ: enter BURST at
+// ACTIVITY_ENTER_SIGMA, leave after ACTIVITY_MIN_BURST_MS under ACTIVITY_EXIT_SIGMA
+#define ACTIVITY_ENTER_SIGMA 4.0
+#define ACTIVITY_EXIT_SIGMA 2.0
+#define ACTIVITY_MIN_BURST_MS 3000
+
+// Load cell: target standard error (g) of the robust estimate; each reading
+// takes 2-8 HX711 conversions until it is met (see RobustEstimator.h).
+// Reachable down to σ/√12 of one conversion (~0.58 g at 2 g noise); lower
+// targets act as that floor.
+#define LOADCELL_TARGET_SE_G 1.0
+
+// Local UDP collector on the LAN (tools/telemetry_collector.cpp).
+// Comment out LOCAL_COLLECTOR_HOST to send to Firebase only.
+#define LOCAL_COLLECTOR_HOST "192.168.1.100"
+#define LOCAL_COLLECTOR_PORT 5005
+#define NODE_ID 1
+
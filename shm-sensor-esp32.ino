@@ -3,6 +3,11 @@
 #include "DisplayManager.h"
 #include "ButtonManager.h"
 #include "FirebaseManager.h"
+#include "TelemetryRouter.h"
+#include "UdpTelemetrySink.h"
+#include "TelemetryWindow.h"
+#include "HeapMonitor.h"
+#include "ActivityDetector.h"
 #include "config.h"
 #include <WiFi.h>
 #include "time.h"
@@ -21,10 +26,80 @@ StrainGaugeSensor strainGauge;
 DisplayManager display;
 ButtonManager buttons;
 FirebaseManager firebase;
+#ifdef LOCAL_COLLECTOR_HOST
+UdpTelemetrySink localSink(LOCAL_COLLECTOR_HOST);
+#endif
+TelemetryRouter telemetrySinks;
+HeapMonitor heap;
+ActivityDetector activity;
+
+// Window per sink: lokal ikut profil sampling, cloud selalu window panjang
+TelemetryWindow cloudWindow(firebase);
+#ifdef LOCAL_COLLECTOR_HOST
+TelemetryWindow localWindow(localSink);
+#endif
+
+#ifndef ADAPTIVE_SAMPLING
+#define ADAPTIVE_SAMPLING 1
+#endif
+#ifndef IDLE_SAMPLE_PERIOD_MS
+#define IDLE_SAMPLE_PERIOD_MS 500
+#endif
+#ifndef IDLE_WINDOW_MS
+#define IDLE_WINDOW_MS 30000
+#endif
+#ifndef BURST_SAMPLE_PERIOD_MS
+#define BURST_SAMPLE_PERIOD_MS 50
+#endif
+#ifndef BURST_WINDOW_MS
+#define BURST_WINDOW_MS 1000
+#endif
+#ifndef ACTIVITY_ENTER_SIGMA
+#define ACTIVITY_ENTER_SIGMA 4.0
+#endif
+#ifndef ACTIVITY_EXIT_SIGMA
+#define ACTIVITY_EXIT_SIGMA 2.0
+#endif
+#ifndef ACTIVITY_MIN_BURST_MS
+#define ACTIVITY_MIN_BURST_MS 3000
+#endif
+
+// Laju sampling dan panjang window upload per kondisi aktivitas
+struct SamplingProfile {
+    const char* name;
+    unsigned long samplePeriodMs;
+    unsigned long windowMs;
+};
+
+// Profil tetap lama (10 Hz, 1 upload per TELEMETRY_WINDOW_MS)
+const unsigned long fixedSamplePeriod = 100;
+
+#if ADAPTIVE_SAMPLING
+const SamplingProfile idleProfile = { "IDLE", IDLE_SAMPLE_PERIOD_MS, IDLE_WINDOW_MS };
+const SamplingProfile burstProfile = { "BURST", BURST_SAMPLE_PERIOD_MS, BURST_WINDOW_MS };
+// Firebase (HTTPS, blocking ratusan ms) tidak ikut window burst: window cloud
+// tetap sepanjang window idle dan tidak ditutup saat ganti profil, series-nya
+// didesimasi ke laju idle. Data laju tinggi hanya ke sink lokal.
+const unsigned long cloudWindowMs = IDLE_WINDOW_MS;
+const unsigned long cloudSeriesPeriodMs = IDLE_SAMPLE_PERIOD_MS;
+#else
+const SamplingProfile idleProfile = { "FIXED", fixedSamplePeriod, TELEMETRY_WINDOW_MS };
+const unsigned long cloudWindowMs = TELEMETRY_WINDOW_MS;
+const unsigned long cloudSeriesPeriodMs = 0;
+#endif
 
 SensorMode currentMode = MODE_LOAD_CELL;
-unsigned long lastSend = 0;
-const unsigned long sendInterval = 5000;
+const SamplingProfile* profile = &idleProfile;
+unsigned long lastHeapReport = 0;
+const unsigned long heapReportInterval = 60000;
+
+// Akumulasi untuk laporan duty-cycle / data (byte nyata dihitung per sink)
+unsigned long samplesTaken = 0;
+unsigned long accountingStart = 0;
+
+// Alert "perlu tare ulang" sudah terkirim (reset setiap tare)
+bool loadCellRetareSent = false;
+bool strainRetareSent = false;
 
 void setupWiFi() {
     WiFi.begin(ssid, password);
@@ -52,14 +127,121 @@ void setupTime() {
         now = time(nullptr);
     }
     
-    Serial.println("Time acquired: " + String(now));
+    char timeText[21];
+    snprintf(timeText, sizeof(timeText), "%ld", (long)now);
+    Serial.print("Time acquired: ");
+    Serial.println(timeText);
     
     display.setCursor(0,2);
     display.print("Time Now: ");
-    display.print(String(now));
+    display.print(timeText);
     delay(1000);
 }
 
+// Window lokal mengikuti profil aktif; series memakai kalibrasi terkini
+void startLocalWindow() {
+    #ifdef LOCAL_COLLECTOR_HOST
+    StrainCalibration cal;
+    strainGauge.getCalibration(cal);
+    localWindow.start(profile->windowMs, profile->samplePeriodMs, cal);
+    #endif
+}
+
+void startCloudWindow() {
+    StrainCalibration cal;
+    strainGauge.getCalibration(cal);
+    cloudWindow.start(cloudWindowMs, profile->samplePeriodMs, cal);
+}
+
+// Kirim window yang sedang berjalan ke sink lokal (tidak menunggu HTTPS)
+void sendLocalWindow() {
+    #ifdef LOCAL_COLLECTOR_HOST
+    localWindow.send(currentMode);
+    #endif
+}
+
+bool isLocalWindowComplete() {
+    #ifdef LOCAL_COLLECTOR_HOST
+    return localWindow.isComplete();
+    #else
+    return false;
+    #endif
+}
+
+// Saat burst tidak ada write HTTPS: upload Firebase ditahan sampai idle
+bool isBurstProfile() {
+    #if ADAPTIVE_SAMPLING
+    return profile == &burstProfile;
+    #else
+    return false;
+    #endif
+}
+
+// Tutup kedua window (ganti mode / tare) supaya data lama tidak hilang
+void sendAllWindows() {
+    sendLocalWindow();
+    cloudWindow.send(currentMode);
+}
+
+void startAllWindows() {
+    startLocalWindow();
+    startCloudWindow();
+}
+
+// Noise σ sensor aktif jadi acuan detektor aktivitas
+void resetActivity() {
+    if (currentMode == MODE_LOAD_CELL) {
+        activity.setNoiseSigma(loadCell.getNoiseSigma());
+    } else {
+        activity.setNoiseSigma(strainGauge.getNoiseAdc());
+    }
+    activity.reset();
+}
+
+void reportActivity() {
+    unsigned long elapsed = millis() - accountingStart;
+    unsigned long total = activity.getIdleMs() + activity.getBurstMs();
+    float burstPct = total ? 100.0f * activity.getBurstMs() / total : 0;
+    
+    Serial.printf("Activity: %s, burst %.1f%% (%lu transitions), %lu samples in %lu s\n",
+                  profile->name, burstPct, (unsigned long)activity.getTransitions(),
+                  samplesTaken, elapsed / 1000);
+    Serial.printf("Uploads: firebase %lu msg / %lu B (%lu windows)\n",
+                  (unsigned long)firebase.getMessagesSent(), (unsigned long)firebase.getBytesSent(),
+                  (unsigned long)cloudWindow.getWindowsSent());
+    #ifdef LOCAL_COLLECTOR_HOST
+    Serial.printf("Uploads: local %lu msg / %lu B (%lu windows)\n",
+                  (unsigned long)localSink.getMessagesSent(), (unsigned long)localSink.getBytesSent(),
+                  (unsigned long)localWindow.getWindowsSent());
+    #endif
+}
+
+// Auto-zero sudah mencapai batas koreksi: offset bergeser lebih dari yang
+// wajar untuk drift termal, jadi minta tare manual (sekali per sensor)
+void checkRetare() {
+    if (loadCell.needsRetare() && !loadCellRetareSent) {
+        Serial.println("Load cell: zero drift di batas, perlu tare ulang");
+        telemetrySinks.sendAlert("Load cell zero drift limit reached, re-tare needed", "warning");
+        loadCellRetareSent = true;
+    }
+    if (strainGauge.needsRetare() && !strainRetareSent) {
+        Serial.println("Strain gauge: zero drift di batas, perlu tare ulang");
+        telemetrySinks.sendAlert("Strain gauge zero drift limit reached, re-tare needed", "warning");
+        strainRetareSent = true;
+    }
+}
+
+const char* zeroState(bool retare, bool tracking) {
+    if (retare) return "re-tare";
+    return tracking ? "tracking" : "hold";
+}
+
+void reportHeap() {
+    heap.sample();
+    heap.printSerialOutput();
+    telemetrySinks.sendHeapStats(heap, strainGauge.getZeroDrift(), loadCell.getZeroDrift());
+}
+
 void setup() {
     Serial.begin(115200);
     
@@ -92,7 +274,18 @@ void setup() {
     #endif
     loadCell.begin();
     strainGauge.begin();
-    firebase.begin();
+    // Sink lokal dulu: UDP tidak boleh menunggu round-trip HTTPS Firebase
+    #ifdef LOCAL_COLLECTOR_HOST
+    telemetrySinks.addSink(&localSink);
+    #endif
+    telemetrySinks.addSink(&firebase);
+    telemetrySinks.begin();
+    cloudWindow.setSeriesPeriod(cloudSeriesPeriodMs);
+    activity.begin(strainGauge.getNoiseAdc());
+    activity.setThresholds(ACTIVITY_ENTER_SIGMA, ACTIVITY_EXIT_SIGMA, ACTIVITY_MIN_BURST_MS);
+    resetActivity();
+    startAllWindows();
+    accountingStart = millis();
     
     display.showMessage("TIMBANGAN DIGITAL", "Siap Digunakan");
     delay(2000);
@@ -105,10 +298,15 @@ void loop() {
     
     // Cek jika tombol mode ditekan
     if (buttons.isModePressed()) {
+        // Kirim window mode lama dulu supaya ekstremnya tidak hilang
+        sendAllWindows();
         currentMode = (currentMode == MODE_LOAD_CELL) ? MODE_STRAIN_GAUGE : MODE_LOAD_CELL;
         display.showModeChange(currentMode);
         delay(1000);
         display.clear();
+        // Jangan campur data dua mode dalam satu window
+        resetActivity();
+        startAllWindows();
     }
     
     // Proses sensor berdasarkan mode
@@ -118,10 +316,15 @@ void loop() {
         // Cek tombol hold/tare untuk load cell
         if (buttons.isHoldPressed()) loadCell.toggleHold();
         if (buttons.isTarePressed()) {
+            // Jangan campur berat sebelum dan sesudah tare dalam satu window
+            sendAllWindows();
             loadCell.tare();
+            loadCellRetareSent = false;
             display.showMessage("LOAD CELL", "TARE DONE");
             delay(1000);
             display.clear();
+            resetActivity();
+            startAllWindows();
         }
         
         // Update display
@@ -130,13 +333,18 @@ void loop() {
         // Serial Output
         Serial.print("Berat: ");
         Serial.print(loadCell.getWeight(), 2);
-        Serial.println(" gram");
+        Serial.printf(" gram (SE %.2f g, %d konversi)\n",
+                      loadCell.getStdError(), loadCell.getLastConversions());
         
-        // Kirim ke Firebase
-        if (millis() - lastSend > sendInterval) {
-            lastSend = millis();
-            firebase.sendLoadCellData(loadCell.getWeight());
-        }
+        // Stream per sample ke sink lokal (Firebase mengabaikan)
+        telemetrySinks.sendLoadCellSample(loadCell.getWeight());
+        
+        // Agregasi per window, ringkasan dikirim per sink saat window tutup
+        cloudWindow.addLoadCell(loadCell.getWeight());
+        #ifdef LOCAL_COLLECTOR_HOST
+        localWindow.addLoadCell(loadCell.getWeight());
+        #endif
+        activity.update(loadCell.getWeight(), millis());
         
     } else { // MODE_STRAIN_GAUGE
         strainGauge.update();
@@ -144,10 +352,15 @@ void loop() {
         // Cek tombol hold/tare untuk strain gauge
         if (buttons.isHoldPressed()) strainGauge.toggleHold();
         if (buttons.isTarePressed()) {
+            // Kirim dulu data dengan kalibrasi lama: offset berubah setelah tare
+            sendAllWindows();
             strainGauge.tare();
+            strainRetareSent = false;
             display.showMessage("STRAIN GAUGE", "TARE DONE");
             delay(1000);
             display.clear();
+            resetActivity();
+            startAllWindows();
         }
         
         // Update display
@@ -161,24 +374,67 @@ void loop() {
         // Update buzzer dan LED
         strainGauge.updateBuzzerAndLED();
         
-        // Kirim alert jika perlu
+        // Kirim alert sekali per kenaikan status (juga saat burst: alert
+        // tidak ditunda, tapi tidak diulang tiap sample)
         if (strainGauge.shouldSendAlert()) {
-            firebase.sendAlert(strainGauge.getAlertMessage(), strainGauge.getAlertType());
+            telemetrySinks.sendAlert(strainGauge.getAlertMessage(), strainGauge.getAlertType());
+            strainGauge.markAlertSent();
         }
         
-        // Kirim ke Firebase
-        if (millis() - lastSend > sendInterval) {
-            lastSend = millis();
-            firebase.sendStrainGaugeData(
-                strainGauge.getVout(),
-                strainGauge.getDeltaL(),
-                strainGauge.getLoadPercent(),
-                strainGauge.getStrain(),
-                strainGauge.getStress(),
-                strainGauge.getVr()
-            );
-        }
+        // Stream per sample ke sink lokal (Firebase mengabaikan)
+        telemetrySinks.sendStrainSample(
+            strainGauge.getAdcSum(),
+            strainGauge.getLoadPercent(),
+            strainGauge.getStrain(),
+            strainGauge.getStatus()
+        );
+        
+        // Agregasi per window, ringkasan dikirim per sink saat window tutup
+        cloudWindow.addStrain(strainGauge);
+        #ifdef LOCAL_COLLECTOR_HOST
+        localWindow.addStrain(strainGauge);
+        #endif
+        activity.update(strainGauge.getLastAdc(), millis());
+    }
+    samplesTaken++;
+    checkRetare();
+    
+    // Ganti profil saat aktivitas berubah: tutup window lokal lebih awal
+    // supaya window burst mulai tepat saat event. Window cloud jalan terus.
+    const SamplingProfile* nextProfile = profile;
+    #if ADAPTIVE_SAMPLING
+    nextProfile = activity.getState() == ACTIVITY_BURST ? &burstProfile : &idleProfile;
+    #endif
+    if (nextProfile != profile) {
+        sendLocalWindow();
+        profile = nextProfile;
+        Serial.printf("Sampling profile -> %s (score %.1f)\n", profile->name, activity.getScore());
+        startLocalWindow();
+    } else if (isLocalWindowComplete()) {
+        sendLocalWindow();
+        startLocalWindow();
+    }
+    // Upload cloud ditunda selama burst (maks. 2x window) supaya HTTPS tidak
+    // memotong sampling saat event; terkirim begitu kembali ke idle
+    bool cloudDue = cloudWindow.isComplete();
+    if (isBurstProfile() && cloudWindow.getElapsed() < 2 * cloudWindowMs) cloudDue = false;
+    if (cloudDue) {
+        cloudWindow.send(currentMode);
+        startCloudWindow();
+    }
+    
+    // Laporan kesehatan heap (fragmentasi) untuk soak test jangka panjang;
+    // ikut ke Firebase, jadi ditahan selama burst
+    if (millis() - lastHeapReport > heapReportInterval && !isBurstProfile()) {
+        lastHeapReport = millis();
+        reportHeap();
+        reportActivity();
+        Serial.printf("Zero drift: strain %.3f ADC (%s), load cell %.3f g (%s)\n",
+                      strainGauge.getZeroDrift(), zeroState(strainGauge.needsRetare(), strainGauge.isZeroTracking()),
+                      loadCell.getZeroDrift(), zeroState(loadCell.needsRetare(), loadCell.isZeroTracking()));
+        Serial.printf("Load cell: %lu konversi dibuang sebagai spike sejak tare\n",
+                      (unsigned long)loadCell.getRejectedConversions());
     }
     
-    delay(100);
+    delay(profile->samplePeriodMs);
 }
\ No newline at end of file
@@ -0,0 +1,399 @@
+// Replays a strain trace through ActivityDetector with the sketch's
+// adaptive sampling profiles and compares it with the old fixed profile
+// (10 Hz, 5 s windows): samples taken, time in BURST, and the bytes and
+// messages each sink would have sent, alerts included. Upload sizes come
+// from the device encoders (TelemetryJson, JsonWriter, StrainCodec,
+// TelemetryFrame), so the numbers match the per-sink counters the sketch
+// prints every minute.
+//
+// Build (Linux):
+//   g++ -O2 -std=c++11 -I.. activity_replay.cpp ../ActivityDetector.cpp ../RunningStats.cpp ../JsonWriter.cpp ../TelemetryJson.cpp ../StrainCodec.cpp -o activity_replay
+// Run:
+//   ./activity_replay [trace.csv [period_ms]]
+// trace.csv: "t_ms,adc" per line, or one raw ADC reading (0..4095) per line
+// recorded every period_ms (default 10). Without a file a synthetic hour is
+// used. Strain gauge mode only: load-cell mode paces itself on HX711
+// conversions (see README) and is out of scope here. Loop overhead (LCD,
+// sends) is not modelled.
+
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "ActivityDetector.h"
+#include "JsonWriter.h"
+#include "RunningStats.h"
+#include "StrainCodec.h"
+#include "SystemStatus.h"
+#include "TelemetryFrame.h"
+#include "TelemetryJson.h"
+
+// Sketch / config.example.h defaults
+static const int AVERAGE_LENGTH = 20;          // StrainGaugeSensor::N
+static const int TARE_SAMPLES = 400;           // StrainGaugeSensor::tare()
+static const size_t SERIES_BUFFER = 512;       // TelemetryWindow::SERIES_SIZE
+static const size_t STATS_FRAME = FRAME_HEADER_SIZE + 6 * FRAME_STATS_SIZE;
+static const size_t SAMPLE_FRAME = FRAME_HEADER_SIZE + 13;
+
+struct Profile {
+    const char* name;
+    unsigned long samplePeriodMs;
+    unsigned long windowMs;
+};
+
+static const Profile fixedProfile = { "FIXED", 100, 5000 };
+static const Profile idleProfile = { "IDLE", 500, 30000 };
+static const Profile burstProfile = { "BURST", 50, 1000 };
+
+struct Trace {
+    std::string name;
+    std::vector<unsigned long> timeMs;
+    std::vector<int> adc;
+};
+
+struct SinkCount {
+    uint64_t bytes = 0;
+    uint64_t messages = 0;
+    uint64_t inBurst = 0;    // Messages sent while the detector was in BURST
+
+    void add(size_t size, bool burst) {
+        bytes += size;
+        messages++;
+        if (burst) inBurst++;
+    }
+};
+
+// Mirror of StrainGaugeSensor status and alert latch: one alert per
+// escalation, re-armed once the load falls below 25 %
+class AlertLatch {
+private:
+    SystemStatus alerted = STATUS_NORMAL;
+
+public:
+    static SystemStatus status(float loadPercent) {
+        if (loadPercent >= 80) return STATUS_DANGER;
+        if (loadPercent >= 40) return STATUS_WARNING;
+        if (loadPercent >= 30) return STATUS_NOTICE;
+        return STATUS_NORMAL;
+    }
+
+    // True if the sketch sends an alert for this sample
+    bool update(float loadPercent) {
+        SystemStatus current = status(loadPercent);
+        if (loadPercent < 25.0f) alerted = STATUS_NORMAL;
+        if (current <= alerted) return false;
+        alerted = current;
+        return true;
+    }
+
+    static const char* message(SystemStatus s) {
+        switch (s) {
+            case STATUS_NOTICE: return "Strain level elevated";
+            case STATUS_WARNING: return "High strain detected";
+            case STATUS_DANGER: return "Load capacity exceeded (≥90%)";
+            default: return "";
+        }
+    }
+
+    static const char* type(SystemStatus s) {
+        switch (s) {
+            case STATUS_NOTICE: return "info";
+            case STATUS_WARNING: return "warning";
+            case STATUS_DANGER: return "danger";
+            default: return "";
+        }
+    }
+};
+
+// FirebaseManager::sendAlert body and UdpTelemetrySink ALERT frame
+static void sendAlert(SystemStatus s, SinkCount& cloud, SinkCount& local, bool burst) {
+    char json[128];
+    JsonWriter writer(json, sizeof(json));
+    writer.beginObject();
+    writer.add("message", AlertLatch::message(s));
+    writer.add("type", AlertLatch::type(s));
+    writer.endObject();
+    local.add(FRAME_HEADER_SIZE + 2 + strlen(AlertLatch::message(s)) + strlen(AlertLatch::type(s)), burst);
+    cloud.add(writer.size(), burst);
+}
+
+// Mirror of TelemetryWindow: strain stats + series for one sink
+class Window {
+private:
+    RunningStats channels[6];
+    uint8_t buffer[SERIES_BUFFER];
+    StrainSeriesEncoder series = StrainSeriesEncoder(buffer, SERIES_BUFFER);
+    unsigned long startMs = 0;
+    unsigned long windowMs = 0;
+    unsigned long seriesPeriodMs = 0;
+    unsigned long lastSeriesMs = 0;
+
+public:
+    explicit Window(unsigned long seriesPeriodMs) : seriesPeriodMs(seriesPeriodMs) {}
+
+    void start(unsigned long nowMs, unsigned long lengthMs, const StrainCalibration& cal) {
+        for (int i = 0; i < 6; i++) channels[i].reset();
+        series.begin(cal, 0, 0);
+        startMs = nowMs;
+        windowMs = lengthMs;
+    }
+
+    void add(unsigned long nowMs, int32_t adcSum, const StrainReading& r) {
+        channels[0].add(r.vout);
+        channels[1].add(r.deltaL);
+        channels[2].add(r.loadPercent);
+        channels[3].add(r.strain);
+        channels[4].add(r.stress);
+        channels[5].add(r.vr);
+        if (series.getCount() > 0 && nowMs - lastSeriesMs < seriesPeriodMs) return;
+        if (series.add(adcSum)) lastSeriesMs = nowMs;
+    }
+
+    unsigned long elapsed(unsigned long nowMs) const { return nowMs - startMs; }
+    bool complete(unsigned long nowMs) const { return elapsed(nowMs) >= windowMs; }
+
+    // Firebase: stats JSON + series blob
+    void sendCloud(SinkCount& sink, bool burst) {
+        if (channels[0].getCount() == 0) return;
+        char json[1024];
+        JsonWriter writer(json, sizeof(json));
+        writeStrainGaugeJson(writer, channels[0], channels[1], channels[2],
+                             channels[3], channels[4], channels[5]);
+        sink.add(writer.size(), burst);
+        sink.add(series.size(), burst);
+    }
+
+    // UDP: stats frame + series frame
+    void sendLocal(SinkCount& sink, bool burst) {
+        if (channels[0].getCount() == 0) return;
+        sink.add(STATS_FRAME, burst);
+        sink.add(FRAME_HEADER_SIZE + series.size(), burst);
+    }
+};
+
+struct Result {
+    unsigned long durationMs = 0;
+    uint64_t samples = 0;
+    unsigned long burstMs = 0;
+    uint32_t transitions = 0;
+    uint64_t alerts = 0;
+    uint64_t samplesOverNotice = 0;    // Alerts the sketch sent before the latch
+    SinkCount cloud;
+    SinkCount local;
+};
+
+static int clampAdc(long v) {
+    if (v < 0) return 0;
+    if (v > 4095) return 4095;
+    return (int)v;
+}
+
+static bool loadTrace(const char* path, unsigned long periodMs, Trace& trace) {
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+    char line[128];
+    unsigned long n = 0;
+    while (fgets(line, sizeof(line), f)) {
+        char* end;
+        long first = strtol(line, &end, 10);
+        if (end == line) continue;    // Header or blank line
+        if (*end == ',') {
+            char* valueEnd;
+            long value = strtol(end + 1, &valueEnd, 10);
+            if (valueEnd == end + 1) continue;
+            trace.timeMs.push_back((unsigned long)first);
+            trace.adc.push_back(clampAdc(value));
+        } else {
+            trace.timeMs.push_back(n * periodMs);
+            trace.adc.push_back(clampAdc(first));
+        }
+        n++;
+    }
+    fclose(f);
+    trace.name = path;
+    return trace.adc.size() > (size_t)TARE_SAMPLES;
+}
+
+// One hour at 10 ms: quiet noise, a vehicle-like passage every 10 minutes
+// (every other one heavy enough for WARNING), one slow thermal-like ramp
+// and a few single-conversion spikes
+static Trace syntheticTrace() {
+    std::mt19937 rng(7);
+    std::normal_distribution<float> noise(0, 3.0f);
+    Trace trace;
+    trace.name = "synthetic 1 h";
+    const unsigned long period = 10;
+    const unsigned long duration = 3600000;
+    for (unsigned long t = 0; t < duration; t += period) {
+        float v = 2048 + noise(rng);
+        unsigned long inCycle = t % 600000;
+        if (inCycle >= 300000 && inCycle < 320000) {
+            float s = (inCycle - 300000) / 1000.0f;
+            float amplitude = (t / 600000) % 2 ? 1500.0f : 400.0f;
+            v -= amplitude * sinf(3.14159f * s / 20.0f) * (1.0f + 0.3f * sinf(12.0f * s));
+        }
+        if (t >= 1800000 && t < 2400000) v -= 60.0f * (t - 1800000) / 600000.0f;
+        if (t >= 2400000) v -= 60.0f;
+        if (t % 97000 == 0) v += 300.0f;
+        trace.timeMs.push_back(t);
+        trace.adc.push_back(clampAdc(lroundf(v)));
+    }
+    return trace;
+}
+
+// Tare as on the device: offset from the mean, σ of single conversions
+static void tare(const Trace& trace, StrainCalibration& cal, float& sigma) {
+    double sum = 0;
+    double sumSq = 0;
+    for (int i = 0; i < TARE_SAMPLES; i++) {
+        sum += trace.adc[i];
+        sumSq += (double)trace.adc[i] * trace.adc[i];
+    }
+    double mean = sum / TARE_SAMPLES;
+    double variance = sumSq / TARE_SAMPLES - mean * mean;
+    sigma = variance > 0 ? (float)sqrt(variance) : 0.0f;
+
+    cal.offsetAdc = (float)mean;
+    cal.noiseThresholdAdc = 3.0f * sigma;
+    cal.vref = 3.3f;
+    cal.vin = 5.0f;
+    cal.adcMax = 4095;
+    cal.gain = 1215.34f;
+    cal.gaugeFactor = 2.14f;
+    cal.plateLength = 500.0f;
+    cal.modulusE = 100e9f;
+    cal.strainMax = 0.0008f;
+    cal.averageLength = AVERAGE_LENGTH;
+}
+
+static Result replay(const Trace& trace, bool adaptive) {
+    StrainCalibration cal;
+    float sigma;
+    tare(trace, cal, sigma);
+
+    ActivityDetector detector;
+    detector.begin(sigma);
+    AlertLatch alerts;
+
+    const Profile* profile = adaptive ? &idleProfile : &fixedProfile;
+    const unsigned long cloudWindowMs = adaptive ? idleProfile.windowMs : fixedProfile.windowMs;
+    Window local(0);
+    Window cloud(adaptive ? idleProfile.samplePeriodMs : 0);
+
+    int average[AVERAGE_LENGTH];
+    long adcSum = 0;
+    for (int i = 0; i < AVERAGE_LENGTH; i++) {
+        average[i] = trace.adc[0];
+        adcSum += average[i];
+    }
+    int averageIndex = 0;
+
+    Result result;
+    const unsigned long t0 = trace.timeMs.front();
+    const unsigned long end = trace.timeMs.back();
+    size_t index = 0;
+    local.start(0, profile->windowMs, cal);
+    cloud.start(0, cloudWindowMs, cal);
+
+    for (unsigned long t = t0; t <= end; t += profile->samplePeriodMs) {
+        // Latest recorded conversion at or before t
+        while (index + 1 < trace.timeMs.size() && trace.timeMs[index + 1] <= t) index++;
+        int raw = trace.adc[index];
+        unsigned long now = t - t0;
+
+        adcSum -= average[averageIndex];
+        average[averageIndex] = raw;
+        adcSum += raw;
+        averageIndex = (averageIndex + 1) % AVERAGE_LENGTH;
+        StrainReading reading = reconstructStrain(cal, adcSum);
+        result.samples++;
+
+        bool burst = detector.getState() == ACTIVITY_BURST;
+        if (AlertLatch::status(reading.loadPercent) != STATUS_NORMAL) result.samplesOverNotice++;
+        if (alerts.update(reading.loadPercent)) {
+            sendAlert(AlertLatch::status(reading.loadPercent), result.cloud, result.local, burst);
+            result.alerts++;
+        }
+        result.local.add(SAMPLE_FRAME, burst);
+        local.add(now, adcSum, reading);
+        cloud.add(now, adcSum, reading);
+        detector.update(raw, now);
+        burst = detector.getState() == ACTIVITY_BURST;
+
+        const Profile* next = profile;
+        if (adaptive) next = burst ? &burstProfile : &idleProfile;
+        if (next != profile) {
+            local.sendLocal(result.local, burst);
+            profile = next;
+            local.start(now, profile->windowMs, cal);
+        } else if (local.complete(now)) {
+            local.sendLocal(result.local, burst);
+            local.start(now, profile->windowMs, cal);
+        }
+
+        bool cloudDue = cloud.complete(now);
+        if (adaptive && burst && cloud.elapsed(now) < 2 * cloudWindowMs) cloudDue = false;
+        if (cloudDue) {
+            cloud.sendCloud(result.cloud, burst);
+            cloud.start(now, cloudWindowMs, cal);
+        }
+    }
+
+    result.durationMs = end - t0;
+    result.burstMs = detector.getBurstMs();
+    result.transitions = detector.getTransitions();
+    return result;
+}
+
+static void printRow(const char* name, const Result& r) {
+    double hours = r.durationMs / 3600000.0;
+    printf("%-9s %9llu %6.1f%% %5u %6llu  %8.0f %10.0f %6llu  %8.0f %10.0f\n",
+           name, (unsigned long long)r.samples,
+           r.durationMs ? 100.0 * r.burstMs / r.durationMs : 0.0, r.transitions,
+           (unsigned long long)r.alerts,
+           r.cloud.messages / hours, r.cloud.bytes / hours, (unsigned long long)r.cloud.inBurst,
+           r.local.messages / hours, r.local.bytes / hours);
+}
+
+static double ratio(uint64_t a, uint64_t b) {
+    return b ? (double)a / b : 0.0;
+}
+
+int main(int argc, char** argv) {
+    Trace trace;
+    if (argc > 1) {
+        unsigned long period = argc > 2 ? strtoul(argv[2], nullptr, 10) : 10;
+        if (period == 0 || !loadTrace(argv[1], period, trace)) {
+            fprintf(stderr, "cannot read trace %s (need more than %d samples)\n", argv[1], TARE_SAMPLES);
+            return 1;
+        }
+    } else {
+        trace = syntheticTrace();
+    }
+
+    Result fixed = replay(trace, false);
+    Result adaptive = replay(trace, true);
+
+    printf("%s: %.1f min, %zu conversions\n\n", trace.name.c_str(),
+           fixed.durationMs / 60000.0, trace.adc.size());
+    printf("%-9s %9s %7s %5s %6s  %8s %10s %6s  %8s %10s\n",
+           "profile", "samples", "burst", "trans", "alerts", "cloud", "cloud", "cloud", "local", "local");
+    printf("%-9s %9s %7s %5s %6s  %8s %10s %6s  %8s %10s\n",
+           "", "", "", "", "", "msg/h", "B/h", "burst", "msg/h", "B/h");
+    printRow("fixed", fixed);
+    printRow("adaptive", adaptive);
+
+    printf("\nadaptive / fixed: samples %.2fx, cloud bytes %.2fx, cloud messages %.2fx, local bytes %.2fx\n",
+           ratio(adaptive.samples, fixed.samples),
+           ratio(adaptive.cloud.bytes, fixed.cloud.bytes),
+           ratio(adaptive.cloud.messages, fixed.cloud.messages),
+           ratio(adaptive.local.bytes, fixed.local.bytes));
+    printf("alerts: one per escalation; without the latch every sample over NOTICE "
+           "would send one (fixed %llu, adaptive %llu per sink)\n",
+           (unsigned long long)fixed.samplesOverNotice, (unsigned long long)adaptive.samplesOverNotice);
+    return 0;
+}
@@ -0,0 +1,257 @@
+// Host soak test for the sketch's per-sample and per-window code paths:
+// RunningStats, TelemetryJson/JsonWriter, StrainSeriesEncoder, UDP frame
+// packing, ActivityDetector, BaselineTracker and RobustEstimator, looped
+// for millions of simulated samples with every heap allocation counted.
+// The device side promises these paths never touch the heap after setup;
+// any allocation during the soak fails the run. What the Firebase library
+// and the HTTPS client allocate per send can only be measured on the
+// board (HeapProbe, the sendHeapDrop fields in /health).
+//
+// Build (Linux, glibc):
+//   g++ -O2 -std=c++11 -I.. heap_soak.cpp ../RunningStats.cpp ../JsonWriter.cpp ../TelemetryJson.cpp ../StrainCodec.cpp ../ActivityDetector.cpp ../BaselineTracker.cpp ../RobustEstimator.cpp -o heap_soak
+// Run:
+//   ./heap_soak [samples]     (default 10000000 = 11.6 days at 10 Hz)
+
+#include <chrono>
+#include <new>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ActivityDetector.h"
+#include "BaselineTracker.h"
+#include "JsonWriter.h"
+#include "RobustEstimator.h"
+#include "RunningStats.h"
+#include "StrainCodec.h"
+#include "TelemetryFrame.h"
+#include "TelemetryJson.h"
+
+// ---- Allocation counting ----------------------------------------------------
+
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t n, size_t size);
+extern "C" void* __libc_realloc(void* p, size_t size);
+extern "C" void __libc_free(void* p);
+
+static bool counting = false;
+static unsigned long long allocations = 0;
+static unsigned long long allocatedBytes = 0;
+
+static void countAllocation(size_t size) {
+    if (!counting) return;
+    allocations++;
+    allocatedBytes += size;
+}
+
+extern "C" void* malloc(size_t size) {
+    countAllocation(size);
+    return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t n, size_t size) {
+    countAllocation(n * size);
+    return __libc_calloc(n, size);
+}
+
+extern "C" void* realloc(void* p, size_t size) {
+    countAllocation(size);
+    return __libc_realloc(p, size);
+}
+
+extern "C" void free(void* p) {
+    __libc_free(p);
+}
+
+void* operator new(size_t size) {
+    void* p = malloc(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    free(p);
+}
+
+// ---- Device code paths ------------------------------------------------------
+
+static const int CHANNELS = 7;                 // TelemetryChannel count
+static const int SAMPLES_PER_WINDOW = 50;      // 5 s at 10 Hz
+
+// Everything the sketch allocates statically at setup
+struct Node {
+    RunningStats channels[CHANNELS];
+    char json[1024];
+    JsonWriter writer = JsonWriter(json, sizeof(json));
+    uint8_t series[512];
+    StrainSeriesEncoder encoder = StrainSeriesEncoder(series, sizeof(series));
+    uint8_t frame[640];
+    uint32_t seq = 0;
+    ActivityDetector activity;
+    BaselineTracker strainBaseline;
+    BaselineTracker loadBaseline;
+    RobustEstimator estimator;
+    StrainCalibration calibration;
+};
+
+static void setupNode(Node& node) {
+    StrainCalibration& cal = node.calibration;
+    cal.offsetAdc = 2048;
+    cal.noiseThresholdAdc = 9;
+    cal.vref = 3.3f;
+    cal.vin = 5.0f;
+    cal.adcMax = 4095;
+    cal.gain = 1215.34f;
+    cal.gaugeFactor = 2.14f;
+    cal.plateLength = 500.0f;
+    cal.modulusE = 100e9f;
+    cal.strainMax = 0.0008f;
+    cal.averageLength = 20;
+
+    node.activity.begin(3.0f);
+    node.strainBaseline.begin(9.0f, 0.005f);
+    node.loadBaseline.begin(5.0f, 0.0005f);
+    node.estimator.begin(1.0f, 0.1f);
+    node.encoder.begin(cal, 0, 100);
+}
+
+static void packFrame(Node& node, FrameType type, size_t payloadLength, unsigned long nowMs) {
+    FrameHeader header;
+    header.type = type;
+    header.nodeId = 1;
+    header.seq = node.seq++;
+    header.uptimeMs = nowMs;
+    header.payloadLength = payloadLength;
+    writeFrameHeader(node.frame, header);
+}
+
+static void packStats(uint8_t* p, const RunningStats& stats) {
+    putU32(p, stats.getCount());
+    putFloat(p + 4, stats.getMin());
+    putFloat(p + 8, stats.getMax());
+    putFloat(p + 12, stats.getMean());
+    putFloat(p + 16, stats.getRms());
+    putFloat(p + 20, stats.getStdDev());
+    putFloat(p + 24, stats.getPeakToPeak());
+}
+
+// One loop(): both sensors' math, per-sample frame, window aggregation
+static void sample(Node& node, int adc, float conversion, unsigned long nowMs) {
+    node.estimator.add(conversion);
+    float weight = node.estimator.getEstimate();
+    weight -= node.loadBaseline.update(weight, nowMs);
+
+    float residual = adc - node.calibration.offsetAdc;
+    node.calibration.offsetAdc += node.strainBaseline.update(residual, nowMs);
+    int32_t adcSum = adc * 20;
+    StrainReading r = reconstructStrain(node.calibration, adcSum);
+
+    node.channels[0].add(weight);
+    node.channels[1].add(r.vout);
+    node.channels[2].add(r.deltaL);
+    node.channels[3].add(r.loadPercent);
+    node.channels[4].add(r.strain);
+    node.channels[5].add(r.stress);
+    node.channels[6].add(r.vr);
+    node.encoder.add(adcSum);
+    node.activity.update((float)adc, nowMs);
+
+    uint8_t* p = node.frame + FRAME_HEADER_SIZE;
+    putU32(p, (uint32_t)adcSum);
+    putFloat(p + 4, r.loadPercent);
+    putFloat(p + 8, r.strain);
+    p[12] = 0;
+    packFrame(node, FRAME_STRAIN_SAMPLE, 13, nowMs);
+}
+
+// One window close: JSON bodies, UDP stats frames, series, restart
+static size_t closeWindow(Node& node, unsigned long nowMs) {
+    writeLoadCellJson(node.writer, node.channels[0]);
+    size_t bytes = node.writer.size();
+    writeStrainGaugeJson(node.writer, node.channels[1], node.channels[2], node.channels[3],
+                         node.channels[4], node.channels[5], node.channels[6]);
+    bytes += node.writer.size();
+
+    for (int i = 0; i < 6; i++) packStats(node.frame + FRAME_HEADER_SIZE + i * FRAME_STATS_SIZE, node.channels[i + 1]);
+    packFrame(node, FRAME_STRAIN_STATS, 6 * FRAME_STATS_SIZE, nowMs);
+
+    node.encoder.setSamplePeriod(100);
+    bytes += node.encoder.size();
+    StrainSeriesDecoder decoder;
+    int32_t value;
+    decoder.begin(node.encoder.data(), node.encoder.size());
+    while (decoder.next(value)) {}
+
+    for (int i = 0; i < CHANNELS; i++) node.channels[i].reset();
+    node.encoder.begin(node.calibration, nowMs / 1000, 100);
+    return bytes;
+}
+
+int main(int argc, char** argv) {
+    unsigned long long samples = argc > 1 ? strtoull(argv[1], nullptr, 10) : 10000000ULL;
+
+    std::mt19937 rng(3);
+    std::normal_distribution<float> noise(0, 3.0f);
+    static Node node;
+    setupNode(node);
+
+    // The hooks must see a known allocation, or a zero below means nothing
+    counting = true;
+    int* volatile probe = new int(0);
+    delete probe;
+    counting = false;
+    if (allocations != 1) {
+        printf("allocation hooks not active (%llu)\n", allocations);
+        return 2;
+    }
+    allocations = 0;
+    allocatedBytes = 0;
+
+    // Warm-up outside the count: first use of printf/locale etc.
+    printf("soaking %llu samples (%.1f days at 10 Hz)...\n", samples, samples / 864000.0);
+    fflush(stdout);
+
+    unsigned long long windows = 0;
+    unsigned long long uploadBytes = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    counting = true;
+    for (unsigned long long i = 0; i < samples; i++) {
+        unsigned long nowMs = (unsigned long)(i * 100);
+        // Quiet signal with an occasional load so every branch is exercised
+        float load = (i / 3000) % 10 == 0 ? 400.0f : 0.0f;
+        int adc = (int)(2048 - load + noise(rng));
+        sample(node, adc, load * 0.5f + noise(rng), nowMs);
+        if ((i + 1) % SAMPLES_PER_WINDOW == 0) {
+            uploadBytes += closeWindow(node, nowMs);
+            windows++;
+        }
+    }
+    counting = false;
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    printf("%llu windows, %llu payload bytes encoded, %.1f Msamples/s\n",
+           windows, uploadBytes, samples / seconds / 1e6);
+    printf("heap allocations during soak: %llu (%llu bytes)\n", allocations, allocatedBytes);
+    if (allocations) {
+        printf("FAIL: per-sample/per-window code allocated\n");
+        return 1;
+    }
+    printf("OK: no allocations\n");
+    return 0;
+}
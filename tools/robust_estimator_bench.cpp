@@ -0,0 +1,268 @@
+// Sweeps the load cell reading loop (LoadCellSensor::update) over
+// MIN/MAX_CONVERSIONS and LOADCELL_TARGET_SE_G on a simulated HX711 with
+// Gaussian noise and occasional spikes, and compares it with the old
+// 40-conversion mean. Per configuration it reports conversions per
+// reading, the spread of readings on a static load, their lag-1
+// autocorrelation (RobustEstimator keeps a 16-conversion window, so
+// consecutive readings share most of their samples and the spread alone
+// overstates how independent they are), the worst reading error, and how
+// long a 4 g and a 100 g step take to settle.
+//
+// Build (Linux):
+//   g++ -O2 -std=c++11 -I.. robust_estimator_bench.cpp ../RobustEstimator.cpp -o robust_estimator_bench
+// Run:
+//   ./robust_estimator_bench [noise_sigma_g [spike_rate]]
+// Without spike_rate two tables are printed: no spikes, and 1 % spikes.
+// Standard-error targets below σ/√12 (the estimator's floor) behave as
+// the floor.
+// Readings are the estimator output, before auto-zero and the ±5 g dead
+// zone. Times assume the HX711 at 10 SPS (RATE pin low).
+
+#include <algorithm>
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "RobustEstimator.h"
+
+static const float CONVERSION_MS = 100.0f;     // HX711 at 10 SPS
+static const float BASE_WEIGHT = 100.0f;
+static const float SETTLE_TOLERANCE = 1.0f;    // g around the new load
+static const int SETTLE_HOLD = 5;              // readings that must stay inside
+static const int STEP_TRIALS = 400;
+static const int STEP_MAX_READINGS = 100;
+static const int STATIC_READINGS = 20000;
+
+struct Config {
+    int minConversions;
+    int maxConversions;
+    float targetStdError;
+    bool plainMean;    // Old update(): get_units(40), no estimator
+};
+
+// Simulated HX711: noisy conversions with rare large spikes
+class Hx711Model {
+private:
+    std::mt19937 rng;
+    std::normal_distribution<float> noise;
+    std::uniform_real_distribution<float> unit;
+    float spikeRate;
+    float weight = BASE_WEIGHT;
+    long conversions = 0;
+    long stepAt = -1;
+    float stepTo = 0;
+
+public:
+    Hx711Model(unsigned seed, float sigma, float spikeRate)
+        : rng(seed), noise(0, sigma), unit(0, 1), spikeRate(spikeRate) {}
+
+    void scheduleStep(long atConversion, float to) {
+        stepAt = atConversion;
+        stepTo = to;
+    }
+
+    float convert() {
+        if (conversions == stepAt) weight = stepTo;
+        conversions++;
+        float v = weight + noise(rng);
+        if (unit(rng) < spikeRate) {
+            float magnitude = 20.0f + 480.0f * unit(rng);
+            v += unit(rng) < 0.5f ? magnitude : -magnitude;
+        }
+        return v;
+    }
+
+    long getConversions() const { return conversions; }
+    float uniform() { return unit(rng); }
+};
+
+// Mirror of LoadCellSensor::tare() / update() without auto-zero and dead zone
+class ReadingLoop {
+private:
+    Config config;
+    RobustEstimator estimator;
+
+public:
+    explicit ReadingLoop(const Config& config) : config(config) {}
+
+    void tare(Hx711Model& hx) {
+        estimator.begin(config.targetStdError, 0.1f);
+        for (int i = 0; i < RobustEstimator::WINDOW; i++) estimator.add(hx.convert());
+    }
+
+    float read(Hx711Model& hx) {
+        if (config.plainMean) {
+            float sum = 0;
+            for (int i = 0; i < 40; i++) sum += hx.convert();
+            return sum / 40;
+        }
+        int n = 0;
+        do {
+            estimator.add(hx.convert());
+            n++;
+        } while (n < config.minConversions || (!estimator.isConfident() && n < config.maxConversions));
+        return estimator.getEstimate();
+    }
+};
+
+struct StaticResult {
+    double conversionsPerReading;
+    double stdDev;
+    double lag1;
+    double worstError;
+};
+
+struct StepResult {
+    double medianReadings;
+    double p90Readings;
+    double medianMs;
+    double p90Ms;
+    int unsettled;
+};
+
+static StaticResult runStatic(const Config& config, float sigma, float spikeRate) {
+    Hx711Model hx(1, sigma, spikeRate);
+    ReadingLoop loop(config);
+    loop.tare(hx);
+    long start = hx.getConversions();
+
+    std::vector<double> errors(STATIC_READINGS);
+    for (int i = 0; i < STATIC_READINGS; i++) errors[i] = loop.read(hx) - BASE_WEIGHT;
+
+    double mean = 0;
+    for (double e : errors) mean += e;
+    mean /= errors.size();
+    double variance = 0;
+    double covariance = 0;
+    double worst = 0;
+    for (size_t i = 0; i < errors.size(); i++) {
+        double d = errors[i] - mean;
+        variance += d * d;
+        if (i > 0) covariance += d * (errors[i - 1] - mean);
+        worst = std::max(worst, fabs(errors[i]));
+    }
+
+    StaticResult r;
+    r.conversionsPerReading = (double)(hx.getConversions() - start) / STATIC_READINGS;
+    r.stdDev = sqrt(variance / errors.size());
+    r.lag1 = variance > 0 ? covariance / variance : 0;
+    r.worstError = worst;
+    return r;
+}
+
+static double percentile(std::vector<double> values, double p) {
+    std::sort(values.begin(), values.end());
+    size_t i = (size_t)(p * (values.size() - 1) + 0.5);
+    return values[i];
+}
+
+// Step at a random conversion after warm-up; latency runs from the step to
+// the end of the first reading that stays within tolerance for SETTLE_HOLD
+static StepResult runStep(const Config& config, float sigma, float spikeRate, float step) {
+    std::vector<double> readings;
+    std::vector<double> millis;
+    int unsettled = 0;
+    const float target = BASE_WEIGHT + step;
+
+    for (int trial = 0; trial < STEP_TRIALS; trial++) {
+        Hx711Model hx(1000 + trial, sigma, spikeRate);
+        ReadingLoop loop(config);
+        loop.tare(hx);
+        for (int i = 0; i < 50; i++) loop.read(hx);
+
+        long stepAt = hx.getConversions() + (long)(hx.uniform() * 40);
+        hx.scheduleStep(stepAt, target);
+
+        // Readings from the one containing the step, and where each ended
+        std::vector<float> values;
+        std::vector<long> ends;
+        while ((int)values.size() < STEP_MAX_READINGS + SETTLE_HOLD) {
+            float value = loop.read(hx);
+            if (hx.getConversions() <= stepAt) continue;
+            values.push_back(value);
+            ends.push_back(hx.getConversions());
+        }
+
+        int settled = -1;
+        for (int i = 0; i < STEP_MAX_READINGS && settled < 0; i++) {
+            bool inside = true;
+            for (int j = i; j < i + SETTLE_HOLD && inside; j++) {
+                inside = fabsf(values[j] - target) <= SETTLE_TOLERANCE;
+            }
+            if (inside) settled = i;
+        }
+        if (settled < 0) {
+            unsettled++;
+            settled = STEP_MAX_READINGS - 1;
+        }
+        readings.push_back(settled + 1);
+        millis.push_back((ends[settled] - stepAt) * CONVERSION_MS);
+    }
+
+    StepResult r;
+    r.medianReadings = percentile(readings, 0.5);
+    r.p90Readings = percentile(readings, 0.9);
+    r.medianMs = percentile(millis, 0.5);
+    r.p90Ms = percentile(millis, 0.9);
+    r.unsettled = unsettled;
+    return r;
+}
+
+static void printStep(const StepResult& s) {
+    printf("  %3.0f/%-3.0f %6.0f/%-6.0f %3d", s.medianReadings, s.p90Readings, s.medianMs, s.p90Ms, s.unsettled);
+}
+
+static void run(const Config& config, float sigma, float spikeRate) {
+    StaticResult st = runStatic(config, sigma, spikeRate);
+    StepResult small = runStep(config, sigma, spikeRate, 4.0f);
+    StepResult large = runStep(config, sigma, spikeRate, 100.0f);
+
+    if (config.plainMean) {
+        printf("%-14s", "mean of 40");
+    } else {
+        printf("%2d %2d %5.2f    ", config.minConversions, config.maxConversions, config.targetStdError);
+    }
+    printf(" %6.2f %7.3f %6.2f %7.2f", st.conversionsPerReading, st.stdDev, st.lag1, st.worstError);
+    printStep(small);
+    printStep(large);
+    printf("\n");
+}
+
+static void runTable(float sigma, float spikeRate) {
+    printf("HX711 noise %.2f g/conversion, spikes %.1f%% (20-500 g), %.0f ms/conversion, "
+           "SE floor %.2f g\n", sigma, 100 * spikeRate, CONVERSION_MS, sigma / sqrtf(12.0f));
+    printf("step settled = within %.1f g for %d readings; latency median/p90 from the step;\n"
+           "n/s = trials (of %d) not settled after %d readings\n\n",
+           SETTLE_TOLERANCE, SETTLE_HOLD, STEP_TRIALS, STEP_MAX_READINGS);
+    printf("%-14s %6s %7s %6s %7s  %-25s  %-25s\n",
+           "min max  se", "conv/", "std", "lag-1", "worst", "4 g step", "100 g step");
+    printf("%-14s %6s %7s %6s %7s  %-25s  %-25s\n",
+           "", "read", "g", "corr", "err g", "readings  ms         n/s", "readings  ms         n/s");
+
+    run({ 40, 40, 0, true }, sigma, spikeRate);
+    const int mins[] = { 1, 2, 4 };
+    const int maxs[] = { 4, 8, 16 };
+    const float targets[] = { 0.5f, 1.0f, 2.0f };
+    for (int minConversions : mins) {
+        for (int maxConversions : maxs) {
+            if (maxConversions < minConversions) continue;
+            for (float target : targets) {
+                run({ minConversions, maxConversions, target, false }, sigma, spikeRate);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    float sigma = argc > 1 ? strtof(argv[1], nullptr) : 2.0f;
+    if (argc > 2) {
+        runTable(sigma, strtof(argv[2], nullptr));
+    } else {
+        runTable(sigma, 0.0f);
+        printf("\n");
+        runTable(sigma, 0.01f);
+    }
+    return 0;
+}
@@ -0,0 +1,219 @@
+// Compression and throughput benchmark for StrainCodec. Runs synthetic
+// strain traces (or a recorded one) through the same 20-sample moving
+// average as StrainGaugeSensor, encodes them in device-sized windows and
+// reports bytes per sample, ratio against the old six-field JSON upload,
+// encode/decode throughput, and checks the round trip.
+//
+// Build (Linux):
+//   g++ -O2 -std=c++11 -I.. strain_codec_bench.cpp ../StrainCodec.cpp ../JsonWriter.cpp -o strain_codec_bench
+// Run:
+//   ./strain_codec_bench [trace.csv]
+// trace.csv: one raw ADC reading (0..4095) per line, first column used.
+
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "JsonWriter.h"
+#include "StrainCodec.h"
+
+static const int AVERAGE_LENGTH = 20;          // StrainGaugeSensor::N
+static const size_t DEVICE_BUFFER = 512;       // strainSeriesBuffer in the sketch
+static const int SAMPLES_PER_WINDOW = 60;      // 30 s idle window at 500 ms
+
+struct Trace {
+    std::string name;
+    std::vector<int32_t> adcSums;
+};
+
+// Raw conversions -> moving-average sums, as StrainGaugeSensor::update()
+static std::vector<int32_t> movingSums(const std::vector<int>& raw) {
+    std::vector<int32_t> sums;
+    int buffer[AVERAGE_LENGTH];
+    long sum = 0;
+    for (int i = 0; i < AVERAGE_LENGTH; i++) {
+        buffer[i] = raw.empty() ? 0 : raw[0];
+        sum += buffer[i];
+    }
+    int idx = 0;
+    for (size_t i = 0; i < raw.size(); i++) {
+        sum -= buffer[idx];
+        buffer[idx] = raw[i];
+        sum += buffer[idx];
+        idx = (idx + 1) % AVERAGE_LENGTH;
+        sums.push_back(sum);
+    }
+    return sums;
+}
+
+static int clampAdc(float v) {
+    if (v < 0) return 0;
+    if (v > 4095) return 4095;
+    return (int)(v + 0.5f);
+}
+
+static std::vector<Trace> syntheticTraces(size_t n) {
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(0, 3.0f);
+    std::uniform_int_distribution<int> anyAdc(0, 4095);
+    std::vector<Trace> traces;
+
+    std::vector<int> raw(n);
+    for (size_t i = 0; i < n; i++) raw[i] = clampAdc(2048 + noise(rng));
+    traces.push_back({ "quiet (sigma 3)", movingSums(raw) });
+
+    for (size_t i = 0; i < n; i++) {
+        float load = (i / 200) % 2 ? -600.0f : 0.0f;   // load on/off every 200 samples
+        raw[i] = clampAdc(2048 + load + noise(rng));
+    }
+    traces.push_back({ "load steps", movingSums(raw) });
+
+    for (size_t i = 0; i < n; i++) {
+        float t = (float)(i % 1000) / 1000.0f;
+        raw[i] = clampAdc(2048 - 1500 * t + noise(rng));
+    }
+    traces.push_back({ "ramps", movingSums(raw) });
+
+    for (size_t i = 0; i < n; i++) raw[i] = anyAdc(rng);
+    traces.push_back({ "full-scale random", movingSums(raw) });
+
+    return traces;
+}
+
+static bool loadTrace(const char* path, Trace& trace) {
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+    std::vector<int> raw;
+    char line[128];
+    while (fgets(line, sizeof(line), f)) {
+        char* end;
+        long v = strtol(line, &end, 10);
+        if (end != line) raw.push_back(clampAdc((float)v));
+    }
+    fclose(f);
+    trace.name = path;
+    trace.adcSums = movingSums(raw);
+    return !raw.empty();
+}
+
+static StrainCalibration calibration() {
+    StrainCalibration cal;
+    cal.offsetAdc = 2048;
+    cal.noiseThresholdAdc = 9;
+    cal.vref = 3.3f;
+    cal.vin = 5.0f;
+    cal.adcMax = 4095;
+    cal.gain = 1215.34f;
+    cal.gaugeFactor = 2.14f;
+    cal.plateLength = 500.0f;
+    cal.modulusE = 100e9f;
+    cal.strainMax = 0.0008f;
+    cal.averageLength = AVERAGE_LENGTH;
+    return cal;
+}
+
+// Size of the pre-series upload: one six-field JSON object per sample
+static size_t jsonBytesPerSample(const StrainCalibration& cal, int32_t sample) {
+    StrainReading r = reconstructStrain(cal, sample);
+    char buffer[256];
+    JsonWriter writer(buffer, sizeof(buffer));
+    writer.beginObject();
+    writer.add("avgVoltage", r.vout);
+    writer.add("deltaL", r.deltaL);
+    writer.add("load", r.loadPercent);
+    writer.add("strain", r.strain);
+    writer.add("stress", r.stress);
+    writer.add("vr", r.vr);
+    writer.endObject();
+    return writer.size();
+}
+
+static double seconds(std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b) {
+    return std::chrono::duration<double>(b - a).count();
+}
+
+static void run(const Trace& trace) {
+    const StrainCalibration cal = calibration();
+    const std::vector<int32_t>& s = trace.adcSums;
+    uint8_t buffer[DEVICE_BUFFER];
+    StrainSeriesEncoder encoder(buffer, sizeof(buffer));
+
+    size_t totalBytes = 0;
+    size_t payloadBytes = 0;
+    size_t jsonBytes = 0;
+    size_t windows = 0;
+    size_t dropped = 0;
+    bool roundTrip = true;
+    double encodeTime = 0;
+    double decodeTime = 0;
+
+    for (size_t start = 0; start < s.size(); start += SAMPLES_PER_WINDOW) {
+        size_t end = start + SAMPLES_PER_WINDOW;
+        if (end > s.size()) end = s.size();
+
+        auto t0 = std::chrono::steady_clock::now();
+        encoder.begin(cal, 0, 500);
+        for (size_t i = start; i < end; i++) {
+            if (!encoder.add(s[i])) dropped++;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        encodeTime += seconds(t0, t1);
+
+        StrainSeriesDecoder decoder;
+        int32_t value;
+        size_t i = start;
+        auto t2 = std::chrono::steady_clock::now();
+        if (!decoder.begin(encoder.data(), encoder.size())) roundTrip = false;
+        while (decoder.next(value)) {
+            if (i >= end || value != s[i]) roundTrip = false;
+            i++;
+        }
+        auto t3 = std::chrono::steady_clock::now();
+        decodeTime += seconds(t2, t3);
+        if (i != start + encoder.getCount()) roundTrip = false;
+
+        totalBytes += encoder.size();
+        payloadBytes += encoder.size() - StrainSeriesEncoder::HEADER_SIZE;
+        windows++;
+    }
+
+    // Ratio against JSON uses a subsample; JSON sizes vary little
+    for (size_t i = 0; i < s.size(); i += 97) jsonBytes += jsonBytesPerSample(cal, s[i]);
+    double jsonPerSample = (double)jsonBytes / ((s.size() + 96) / 97);
+
+    double n = (double)s.size();
+    printf("%-20s %9zu  %7.3f  %7.3f  %8.1fx  %8.1fx  %9.1f  %9.1f  %s%s\n",
+           trace.name.c_str(), s.size(),
+           payloadBytes / n, totalBytes / n,
+           4.0 * n / totalBytes, jsonPerSample * n / totalBytes,
+           n / encodeTime / 1e6, n / decodeTime / 1e6,
+           roundTrip ? "ok" : "MISMATCH",
+           dropped ? " (buffer full)" : "");
+}
+
+int main(int argc, char** argv) {
+    std::vector<Trace> traces;
+    if (argc > 1) {
+        Trace recorded;
+        if (!loadTrace(argv[1], recorded)) {
+            fprintf(stderr, "cannot read trace %s\n", argv[1]);
+            return 1;
+        }
+        traces.push_back(recorded);
+    } else {
+        traces = syntheticTraces(1000000);
+    }
+
+    printf("windows of %d samples, %zu B buffer, %zu B header\n\n",
+           SAMPLES_PER_WINDOW, DEVICE_BUFFER, StrainSeriesEncoder::HEADER_SIZE);
+    printf("%-20s %9s  %7s  %7s  %9s  %9s  %9s  %9s  %s\n",
+           "trace", "samples", "B/samp", "B/samp", "vs int32", "vs JSON", "encode", "decode", "round");
+    printf("%-20s %9s  %7s  %7s  %9s  %9s  %9s  %9s  %s\n",
+           "", "", "payload", "+header", "", "", "Msamp/s", "Msamp/s", "trip");
+    for (const Trace& t : traces) run(t);
+    return 0;
+}
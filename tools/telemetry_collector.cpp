@@ -0,0 +1,205 @@
+// Reference collector for UdpTelemetrySink. Listens on one UDP port, accepts
+// frames from any number of nodes and prints per-node throughput and loss
+// once per report interval. Alerts are printed as they arrive.
+//
+// Build (Linux):
+//   g++ -O2 -std=c++11 -I.. telemetry_collector.cpp ../StrainCodec.cpp -o telemetry_collector
+// Run:
+//   ./telemetry_collector [port] [report_seconds]
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "StrainCodec.h"
+#include "TelemetryFrame.h"
+
+// A backwards seq is a fresh boot, not reordering, if it is below this or if
+// uptime jumped back further than any datagram could be delayed
+static const uint32_t RESTART_SEQ_LIMIT = 16;
+static const uint32_t REORDER_WINDOW_MS = 5000;
+
+struct NodeStats {
+    uint32_t lastSeq = 0;
+    uint32_t lastUptimeMs = 0;
+    bool seen = false;
+    uint64_t frames = 0;        // Since start
+    uint64_t lost = 0;          // Since start, from sequence gaps
+    uint64_t windowFrames = 0;  // Since last report
+    uint64_t windowBytes = 0;
+    uint64_t windowLost = 0;
+    uint64_t reordered = 0;
+    uint32_t restarts = 0;
+    float lastLoadPercent = 0;
+    float lastStrain = 0;
+    float lastWeight = 0;
+};
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void trackSequence(NodeStats& node, const FrameHeader& h) {
+    uint32_t seq = h.seq;
+    if (node.seen) {
+        uint32_t expected = node.lastSeq + 1;
+        if (seq == expected) {
+            // In order
+        } else if (seq > expected) {
+            uint32_t gap = seq - expected;
+            node.lost += gap;
+            node.windowLost += gap;
+        } else if (seq < RESTART_SEQ_LIMIT || h.uptimeMs + REORDER_WINDOW_MS < node.lastUptimeMs) {
+            // Node rebooted: sequence and uptime start over
+            node.restarts++;
+        } else {
+            // Late datagram from a gap already counted as lost
+            node.reordered++;
+            if (node.lost) node.lost--;
+            if (node.windowLost) node.windowLost--;
+            return;
+        }
+    }
+    node.seen = true;
+    node.lastSeq = seq;
+    node.lastUptimeMs = h.uptimeMs;
+}
+
+static void handleFrame(NodeStats& node, const FrameHeader& h, const uint8_t* p) {
+    switch (h.type) {
+        case FRAME_LOAD_SAMPLE:
+            if (h.payloadLength >= 4) node.lastWeight = getFloat(p);
+            break;
+        case FRAME_STRAIN_SAMPLE:
+            if (h.payloadLength >= 13) {
+                node.lastLoadPercent = getFloat(p + 4);
+                node.lastStrain = getFloat(p + 8);
+            }
+            break;
+        case FRAME_ALERT: {
+            if (h.payloadLength < 2) break;
+            uint8_t messageLen = p[0];
+            if (2u + messageLen > h.payloadLength) break;
+            uint8_t typeLen = p[1 + messageLen];
+            if (2u + messageLen + typeLen > h.payloadLength) break;
+            printf("[ALERT] node %u: %.*s (%.*s)\n", h.nodeId,
+                   messageLen, (const char*)p + 1, typeLen, (const char*)p + 2 + messageLen);
+            break;
+        }
+        case FRAME_HEALTH: {
+            // Older firmware sends only the heap fields
+            if (h.payloadLength < FRAME_HEALTH_HEAP_SIZE) break;
+            printf("[HEALTH] node %u: free %u B, largest %u B, frag %.1f%%",
+                   h.nodeId, getU32(p), getU32(p + 8), getFloat(p + 16));
+            if (h.payloadLength >= FRAME_HEALTH_SIZE) {
+                printf(", zero drift strain %.3f ADC, load cell %.3f g", getFloat(p + 24), getFloat(p + 28));
+            }
+            printf("\n");
+            break;
+        }
+        case FRAME_STRAIN_SERIES: {
+            StrainSeriesDecoder decoder;
+            if (!decoder.begin(p, h.payloadLength)) {
+                printf("node %u: malformed strain series\n", h.nodeId);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void report(std::map<uint16_t, NodeStats>& nodes, double elapsed) {
+    uint64_t totalFrames = 0, totalLost = 0;
+    printf("---- %zu node(s), %.1f s ----\n", nodes.size(), elapsed);
+    for (auto& entry : nodes) {
+        NodeStats& n = entry.second;
+        uint64_t expected = n.windowFrames + n.windowLost;
+        double lossPct = expected ? 100.0 * n.windowLost / expected : 0;
+        printf("node %5u  %7.1f frames/s  %8.1f B/s  loss %5.2f%% (total %llu/%llu)  reordered %llu"
+               "  restarts %u  load %.1f%%  strain %.6f  weight %.2f g\n",
+               entry.first, n.windowFrames / elapsed, n.windowBytes / elapsed, lossPct,
+               (unsigned long long)n.lost, (unsigned long long)(n.frames + n.lost),
+               (unsigned long long)n.reordered, n.restarts,
+               n.lastLoadPercent, n.lastStrain, n.lastWeight);
+        totalFrames += n.windowFrames;
+        totalLost += n.windowLost;
+        n.windowFrames = 0;
+        n.windowBytes = 0;
+        n.windowLost = 0;
+    }
+    printf("total      %7.1f frames/s  lost %llu\n", totalFrames / elapsed,
+           (unsigned long long)totalLost);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    int port = argc > 1 ? atoi(argv[1]) : 5005;
+    double reportInterval = argc > 2 ? atof(argv[2]) : 1.0;
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        perror("socket");
+        return 1;
+    }
+
+    // Bigger receive buffer so bursts from many nodes aren't dropped locally
+    int rcvbuf = 4 * 1024 * 1024;
+    setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        perror("bind");
+        return 1;
+    }
+
+    struct timeval timeout;
+    timeout.tv_sec = 0;
+    timeout.tv_usec = 200000;
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    printf("Listening on UDP %d\n", port);
+
+    std::map<uint16_t, NodeStats> nodes;
+    uint64_t rejected = 0;
+    uint8_t buffer[2048];
+    double lastReport = nowSeconds();
+
+    while (true) {
+        ssize_t n = recv(sock, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            FrameHeader h;
+            if (readFrameHeader(buffer, n, h)) {
+                NodeStats& node = nodes[h.nodeId];
+                trackSequence(node, h);
+                node.frames++;
+                node.windowFrames++;
+                node.windowBytes += n;
+                handleFrame(node, h, buffer + FRAME_HEADER_SIZE);
+            } else {
+                rejected++;
+            }
+        }
+
+        double now = nowSeconds();
+        if (now - lastReport >= reportInterval) {
+            report(nodes, now - lastReport);
+            if (rejected) printf("rejected  %llu malformed datagram(s)\n", (unsigned long long)rejected);
+            lastReport = now;
+        }
+    }
+}